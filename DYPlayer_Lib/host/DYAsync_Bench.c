@@ -0,0 +1,286 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYAsync_Bench.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Async queue on the simulator, in simulated wire time at 9600 baud.
+  *          - Query round time: the blocking checkPlayState() then
+  *            getPlayingDevice() of the example main loop against the same
+  *            two queries, and all seven, pipelined through the queue.
+  *          - Knob and browse latency: bursts of volume steps and of select
+  *            requests faster than the wire, with and without coalescing,
+  *            timed from the last request until the module got there.
+  *          - Stop latency: stop() at random times into a queue kept busy
+  *            with path plays, queries and settings, from the call until
+  *            the module received it, with and without the urgent lane.
+  *
+  *          gcc -std=c11 -O2 -IDYPlayer_Lib/inc -IDYPlayer_Lib/host $DY_SRC
+  *              DYPlayer_Lib/host/DYSim.c DYPlayer_Lib/host/DYPlayer_PortSim.c
+  *              DYPlayer_Lib/host/DYAsync_Bench.c -o dyasync_bench
+********************************************************************************/
+/************************************DEFINES***********************************/
+
+#define BENCH_ROUNDS        200     /* Query rounds per measurement            */
+#define BENCH_POLL_US       100     /* Main loop period calling Process        */
+#define BENCH_TX_QUEUE      128     /* Transport buffer of the DMA case        */
+#define BENCH_TRACK_US      600000000U  /* Track outlasts the run             */
+#define BENCH_STEPS         20      /* Knob detents / browse requests          */
+#define BENCH_STEP_US       2000    /* Between two of them                     */
+#define BENCH_STOPS         2000    /* Stops measured per run                  */
+#define BENCH_STOP_GAP_US   60000   /* Mean time between two stops             */
+
+/************************************INCLUDES***********************************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "DYPlayer.h"
+#include "DYPlayer_Async.h"
+#include "DYPlayer_PortSim.h"
+
+
+static DYSim_t     sim;
+static DYPortSim_t port;
+static DYPlayer_t  player;
+static DYAsync_t   async;
+
+/*******************************************************************************
+  @func    : setup
+  @param   : uint16_t txQueue
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Fresh module playing track 1, driver and queue on top of it.
+********************************************************************************/
+static void setup(uint16_t txQueue) {
+    DYSimConfig_t config;
+
+    DYSim_DefaultConfig(&config);
+    config.trackUs = BENCH_TRACK_US;
+    DYSim_Init(&sim, &config);
+    DYPortSim_Init(&port, &sim, txQueue);
+    DYPlayer_Init(&player, &DYTransport_Sim, &port);
+    DYAsync_Init(&async, &player);
+
+    DYPlayer.playSpecified(1);
+    DYTransport_Sim.wait(&port, 50000);
+}
+/*******************************************************************************
+  @func    : serial
+  @param   : uint16_t txQueue
+  @return  : double
+  @date	   : 16.10.26
+  @brief   : us per checkPlayState() + getPlayingDevice() round, blocking.
+********************************************************************************/
+static double serial(uint16_t txQueue) {
+    setup(txQueue);
+
+    uint64_t start = port.now;
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        if ((DYPlayer.checkPlayState() != Playing) || (DYPlayer.getPlayingDevice() != Sd)) {
+            printf("serial: wrong answer in round %d\n", r);
+        }
+    }
+    return (port.now - start) / 1e3 / BENCH_ROUNDS;
+}
+/*******************************************************************************
+  @func    : pipelined
+  @param   : uint16_t txQueue, uint8_t depth, const uint8_t *queries, uint8_t count
+  @return  : double
+  @date	   : 16.10.26
+  @brief   : us per round of `count` queries through the queue at `depth`,
+             polled every BENCH_POLL_US like a main loop would.
+********************************************************************************/
+static double pipelined(uint16_t txQueue, uint8_t depth, const uint8_t *queries, uint8_t count) {
+    DYFuture_t future[QFOLDERNUMBER_CMD - QPLAY_CMD + 1];
+
+    setup(txQueue);
+    DYAsync_SetDepth(&async, depth);
+
+    uint64_t start = port.now;
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        for (uint8_t q = 0; q < count; q++) {
+            DYAsync_Control(&async, queries[q], NULL, NULL, &future[q]);
+        }
+        while (DYAsync_Pending(&async) > 0) {
+            DYAsync_Process(&async);
+            DYTransport_Sim.wait(&port, BENCH_POLL_US);
+        }
+        for (uint8_t q = 0; q < count; q++) {
+            if (future[q].status != DY_ASYNC_DONE) {
+                printf("depth %u: query %u failed in round %d\n", depth, queries[q], r);
+            }
+        }
+    }
+    return (port.now - start) / 1e3 / BENCH_ROUNDS;
+}
+/*******************************************************************************
+  @func    : burst
+  @param   : bool coalesce, bool browse
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : BENCH_STEPS volume + (or select requests, then a playSpecified of
+             the last one) every BENCH_STEP_US, the queue polled in between.
+             Prints the time from the last request until the module reached
+             the final volume (track), and the bytes it took on the wire. A
+             request that finds the queue full is tried again next poll.
+********************************************************************************/
+static void burst(bool coalesce, bool browse) {
+    setup(BENCH_TX_QUEUE);
+    DYPlayer.setVolume(5);
+    DYTransport_Sim.wait(&port, 10000);
+    DYAsync_SetCoalescing(&async, coalesce);
+
+    uint32_t bytes = sim.bytesIn;
+    uint64_t next  = port.now;
+    uint64_t last  = 0;
+    uint16_t goal  = browse ? (uint16_t)(10 + BENCH_STEPS) : (uint16_t)(5 + BENCH_STEPS);
+
+    for (uint16_t n = 1; n <= BENCH_STEPS; ) {
+        if (port.now >= next) {
+            bool ok = browse ? ((n < BENCH_STEPS) ? DYAsync_Select(&async, 10 + n, NULL, NULL, NULL) :
+                                                    DYAsync_PlaySpecified(&async, 10 + n, NULL, NULL, NULL)) :
+                               DYAsync_Control(&async, VOLUME_INC, NULL, NULL, NULL);
+            if (ok) {
+                last  = port.now;
+                next += BENCH_STEP_US * 1000ULL;
+                n++;
+            }
+        }
+        DYAsync_Process(&async);
+        DYTransport_Sim.wait(&port, BENCH_POLL_US);
+    }
+    while ((browse ? sim.track : sim.volume) != goal) {
+        DYAsync_Process(&async);
+        DYTransport_Sim.wait(&port, BENCH_POLL_US);
+    }
+
+    printf("  %-6s %-14s %8.1f ms  %4u bytes  %2u coalesced\n", browse ? "browse" : "knob",
+           coalesce ? "coalesced" : "one by one", (port.now - last) / 1e6,
+           sim.bytesIn - bytes, async.coalesced);
+}
+/*******************************************************************************
+  @func    : background
+  @param   : uint32_t n
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : The n-th command of the busy load: a path play (22 byte frame), a
+             query, an EQ setting or a play state query.
+********************************************************************************/
+static void background(uint32_t n) {
+    DYFrame_t frame;
+
+    switch (n % 4) {
+        case 0:
+            DYFrame_Begin(&frame, controlCommands[SPECIFIEDPATH_CMD][CMD_OPCODE_INDEX]);
+            DYFrame_PutByte(&frame, Sd);
+            DYFrame_PutPath(&frame, "/ADVERT/00005.MP3");
+            DYAsync_SubmitFrame(&async, &frame, NULL, NULL, NULL);
+            break;
+        case 1:
+            DYAsync_Control(&async, QCURRENTSONG_CMD, NULL, NULL, NULL);
+            break;
+        case 2:
+            DYFrame_Begin(&frame, controlCommands[SETEQ_CMD][CMD_OPCODE_INDEX]);
+            DYFrame_PutByte(&frame, (uint8_t)(n % 5));
+            DYAsync_SubmitFrame(&async, &frame, NULL, NULL, NULL);
+            break;
+        default:
+            DYAsync_Control(&async, QPLAY_CMD, NULL, NULL, NULL);
+            break;
+    }
+}
+/*******************************************************************************
+  @func    : compare
+  @param   : const void *a, const void *b
+  @return  : int
+  @date	   : 16.10.26
+  @brief   : qsort order of latencies.
+********************************************************************************/
+static int compare(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+/*******************************************************************************
+  @func    : stops
+  @param   : bool priority
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : BENCH_STOPS stops at random times while the main lane always has
+             four commands waiting. Prints p50, p99 and the worst latency from
+             the stop call until the module received the frame.
+********************************************************************************/
+static void stops(bool priority) {
+    static uint32_t latency[BENCH_STOPS];
+    uint32_t        load = 0;
+
+    setup(BENCH_TX_QUEUE);
+    DYAsync_SetPriority(&async, priority);
+    srand(1);
+
+    for (int i = 0; i < BENCH_STOPS; i++) {
+        uint64_t at = port.now + (uint64_t)(rand() % (2 * BENCH_STOP_GAP_US)) * 1000U;
+
+        while (port.now < at) {
+            while ((uint8_t)(async.head - async.tail) < 4) {
+                background(load++);
+            }
+            DYAsync_Process(&async);
+            DYTransport_Sim.wait(&port, BENCH_POLL_US);
+        }
+
+        uint32_t seen  = sim.opcodeCount[0x04];
+        uint64_t start = port.now;
+        while (!DYAsync_Control(&async, STOP_CMD, NULL, NULL, NULL)) {
+            DYAsync_Process(&async);
+            DYTransport_Sim.wait(&port, BENCH_POLL_US);
+        }
+        while (sim.opcodeCount[0x04] == seen) {
+            DYAsync_Process(&async);
+            DYTransport_Sim.wait(&port, BENCH_POLL_US);
+        }
+        latency[i] = (uint32_t)((port.now - start) / 1000U);
+    }
+
+    qsort(latency, BENCH_STOPS, sizeof(latency[0]), compare);
+    printf("  %-12s p50 %6.1f ms  p99 %6.1f ms  max %6.1f ms\n", priority ? "urgent lane" : "in turn",
+           latency[BENCH_STOPS / 2] / 1e3, latency[(BENCH_STOPS * 99) / 100] / 1e3,
+           latency[BENCH_STOPS - 1] / 1e3);
+}
+/*******************************************************************************
+  @func    : main
+  @param   : void
+  @return  : int
+  @date	   : 16.10.26
+  @brief   : Blocking and queued transmit, depth 1 to 4, then the bursts and
+             the stop latency.
+********************************************************************************/
+int main(void) {
+    static const uint8_t pair[] = { QPLAY_CMD, QCURRENTPLAY_CMD };
+    static const uint8_t all[]  = { QPLAY_CMD, QCURRENTDEV_CMD, QCURRENTPLAY_CMD, QNUMBEROFSONG_CMD,
+                                    QCURRENTSONG_CMD, QFOLDERDIR_CMD, QFOLDERNUMBER_CMD };
+    static const uint16_t txQueue[] = { 0, BENCH_TX_QUEUE };
+
+    for (int t = 0; t < 2; t++) {
+        printf("%s transmit\n", (txQueue[t] == 0) ? "blocking" : "queued");
+        printf("  serial  state+device   %8.0f us\n", serial(txQueue[t]));
+        for (uint8_t depth = 1; depth <= 4; depth++) {
+            printf("  depth %u state+device   %8.0f us   all 7 %8.0f us\n", depth,
+                   pipelined(txQueue[t], depth, pair, sizeof(pair)),
+                   pipelined(txQueue[t], depth, all, sizeof(all)));
+        }
+    }
+
+    printf("%u requests, one every %u us\n", BENCH_STEPS, BENCH_STEP_US);
+    for (int browse = 0; browse < 2; browse++) {
+        burst(false, browse);
+        burst(true, browse);
+    }
+
+    printf("stop() into a busy queue, %u stops\n", BENCH_STOPS);
+    stops(false);
+    stops(true);
+    return 0;
+}
@@ -0,0 +1,215 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYBusy_Test.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 BUSY monitor debounce on the host, edges and polls fed with
+  *          stamps in us, every event recorded. Checks:
+  *          - a single glitch shorter than `debounce` raises no event,
+  *          - a change counts once the level held for `debounce`, stamped
+  *            with its edge,
+  *          - a bouncy change raises one event, at its last edge,
+  *          - an edge the interrupt missed is taken by Poll, at the read,
+  *          - a level that held but was never polled counts at the next
+  *            edge.
+  *
+  *          gcc -std=c11 -O2 -IDYPlayer_Lib/inc DYPlayer_Lib/src/DYPlayer_Busy.c
+  *              DYPlayer_Lib/host/DYBusy_Test.c -o dybusy_test
+********************************************************************************/
+/************************************DEFINES***********************************/
+
+#define TEST_DEBOUNCE       1000        /* us                                  */
+#define TEST_EVENTS_MAX     8
+
+#define LOW                 false       /* BUSY active low: playing            */
+#define HIGH                true
+
+/************************************INCLUDES***********************************/
+#include <stdio.h>
+
+#include "DYPlayer_Busy.h"
+
+/**
+ * Events raised by the monitor.
+ */
+typedef struct
+{
+    DYBusyEvent_t event[TEST_EVENTS_MAX];
+    uint32_t      time[TEST_EVENTS_MAX];
+    int           count;
+} Events_t;
+
+static DYBusy_t busy;
+static Events_t events;
+static int      failures;
+
+#define CHECK(cond, ...)    do { if (!(cond)) { failures++; printf("  FAIL: " __VA_ARGS__); printf("\n"); } } while (0)
+
+
+/*******************************************************************************
+  @func    : onEvent
+  @param   : void *ctx, DYBusyEvent_t event, uint32_t time
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYBusy_t callback, records the event.
+********************************************************************************/
+static void onEvent(void *ctx, DYBusyEvent_t event, uint32_t time) {
+    (void)ctx;
+    if (events.count < TEST_EVENTS_MAX) {
+        events.event[events.count] = event;
+        events.time[events.count]  = time;
+    }
+    events.count++;
+}
+/*******************************************************************************
+  @func    : reset
+  @param   : bool level, uint32_t now
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Monitor settled on `level` at `now`, no events yet.
+********************************************************************************/
+static void reset(bool level, uint32_t now) {
+    DYBusy_Init(&busy, true, TEST_DEBOUNCE, level, now);
+    DYBusy_SetCallback(&busy, onEvent, NULL);
+    events.count = 0;
+}
+/*******************************************************************************
+  @func    : expect
+  @param   : int index, DYBusyEvent_t event, uint32_t time
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Event `index` is `event` stamped `time`.
+********************************************************************************/
+static void expect(int index, DYBusyEvent_t event, uint32_t time) {
+    if (index >= events.count) {
+        CHECK(false, "event %d missing", index);
+        return;
+    }
+    CHECK(events.event[index] == event, "event %d is %s", index,
+          (events.event[index] == DY_BUSY_STARTED) ? "STARTED" : "ENDED");
+    CHECK(events.time[index] == time, "event %d at %u, not %u", index,
+          (unsigned)events.time[index], (unsigned)time);
+}
+/*******************************************************************************
+  @func    : testGlitch
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : BUSY goes inactive for 300 us during a track.
+********************************************************************************/
+static void testGlitch(void) {
+    printf("single glitch\n");
+    reset(LOW, 0);
+
+    DYBusy_Poll(&busy, LOW, 5000);
+    DYBusy_Edge(&busy, HIGH, 10000);
+    DYBusy_Edge(&busy, LOW, 10300);
+    DYBusy_Poll(&busy, LOW, 10500);
+    DYBusy_Poll(&busy, LOW, 12000);
+    DYBusy_Poll(&busy, LOW, 50000);
+    CHECK(events.count == 0, "%d events", events.count);
+    CHECK(DYBusy_Playing(&busy), "not playing after the glitch");
+    CHECK(busy.bounces == 1, "%u bounces", (unsigned)busy.bounces);
+    CHECK((busy.starts == 0) && (busy.ends == 0), "%u starts, %u ends",
+          (unsigned)busy.starts, (unsigned)busy.ends);
+}
+/*******************************************************************************
+  @func    : testChange
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Track end, reported once the level held.
+********************************************************************************/
+static void testChange(void) {
+    printf("clean change\n");
+    reset(LOW, 0);
+
+    DYBusy_Edge(&busy, HIGH, 10000);
+    DYBusy_Poll(&busy, HIGH, 10999);
+    CHECK(events.count == 0, "event before the level held");
+    CHECK(DYBusy_Playing(&busy), "ended before the level held");
+    DYBusy_Poll(&busy, HIGH, 11000);
+    CHECK(events.count == 1, "%d events", events.count);
+    expect(0, DY_BUSY_ENDED, 10000);
+    DYBusy_Poll(&busy, HIGH, 20000);
+    CHECK(events.count == 1, "%d events after a later poll", events.count);
+    CHECK(!DYBusy_Playing(&busy), "still playing");
+}
+/*******************************************************************************
+  @func    : testBounce
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Track start with two bounces on the edge.
+********************************************************************************/
+static void testBounce(void) {
+    printf("bouncy change\n");
+    reset(HIGH, 0);
+
+    DYBusy_Edge(&busy, LOW, 10000);
+    DYBusy_Edge(&busy, HIGH, 10100);
+    DYBusy_Edge(&busy, LOW, 10200);
+    DYBusy_Poll(&busy, LOW, 11000);
+    CHECK(events.count == 0, "event before the last level held");
+    DYBusy_Poll(&busy, LOW, 11200);
+    CHECK(events.count == 1, "%d events", events.count);
+    expect(0, DY_BUSY_STARTED, 10200);
+    CHECK(busy.bounces == 2, "%u bounces", (unsigned)busy.bounces);
+}
+/*******************************************************************************
+  @func    : testMissed
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : No interrupt, Poll reads the new level first.
+********************************************************************************/
+static void testMissed(void) {
+    printf("edge missed by the interrupt\n");
+    reset(HIGH, 0);
+
+    DYBusy_Poll(&busy, LOW, 10000);
+    CHECK(events.count == 0, "event on the first read");
+    DYBusy_Poll(&busy, LOW, 11000);
+    CHECK(events.count == 1, "%d events", events.count);
+    expect(0, DY_BUSY_STARTED, 10000);
+}
+/*******************************************************************************
+  @func    : testUnpolled
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : A whole track between two edges and no Poll: the start counts
+             at the end edge, the end at the next Poll.
+********************************************************************************/
+static void testUnpolled(void) {
+    printf("held level counted at the next edge\n");
+    reset(HIGH, 0);
+
+    DYBusy_Edge(&busy, LOW, 10000);
+    DYBusy_Edge(&busy, HIGH, 90000);
+    CHECK(events.count == 1, "%d events at the end edge", events.count);
+    expect(0, DY_BUSY_STARTED, 10000);
+    DYBusy_Poll(&busy, HIGH, 91000);
+    CHECK(events.count == 2, "%d events", events.count);
+    expect(1, DY_BUSY_ENDED, 90000);
+    CHECK((busy.starts == 1) && (busy.ends == 1), "%u starts, %u ends",
+          (unsigned)busy.starts, (unsigned)busy.ends);
+}
+/*******************************************************************************
+  @func    : main
+  @param   : void
+  @return  : int
+  @date	   : 16.10.26
+  @brief   : Every case, exit code 1 on a failure.
+********************************************************************************/
+int main(void) {
+    testGlitch();
+    testChange();
+    testBounce();
+    testMissed();
+    testUnpolled();
+    printf("%s, %d failures\n", (failures == 0) ? "ok" : "FAILED", failures);
+    return (failures == 0) ? 0 : 1;
+}
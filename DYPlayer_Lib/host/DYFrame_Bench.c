@@ -0,0 +1,172 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYFrame_Bench.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Transport writes and bytes of every `DYPlayer` call. A counting
+  *          transport sits in front of the blocking simulator transport, so
+  *          a write is one HAL_UART_Transmit() of DYTransport_HAL. Queries
+  *          are answered by the simulated module; `rx` is the answer bytes.
+  *
+  *          gcc -std=c11 -O2 -IDYPlayer_Lib/inc -IDYPlayer_Lib/host $DY_SRC
+  *              DYPlayer_Lib/host/DYSim.c DYPlayer_Lib/host/DYPlayer_PortSim.c
+  *              DYPlayer_Lib/host/DYFrame_Bench.c -o dyframe_bench
+********************************************************************************/
+/************************************INCLUDES***********************************/
+#include <stdio.h>
+
+#include "DYPlayer.h"
+#include "DYPlayer_PortSim.h"
+
+/**
+ * Transport counters of the call being measured.
+ */
+typedef struct
+{
+    DYPortSim_t port;
+    uint32_t    writes;
+    uint32_t    txBytes;
+    uint32_t    rxBytes;
+} Counter_t;
+
+static DYSim_t    sim;
+static Counter_t  counter;
+static DYPlayer_t player;
+
+static char path[]     = "/00001*MP3";
+static char sound1[]   = "01";
+static char sound2[]   = "02";
+static char sound3[]   = "03";
+static char *sounds[3] = { sound1, sound2, sound3 };
+
+/* Every call measured: label, expression. */
+#define BENCH_CALLS(X)                                                          \
+    X("play()",                         DYPlayer.play())                        \
+    X("pause()",                        DYPlayer.pause())                       \
+    X("stop()",                         DYPlayer.stop())                        \
+    X("previous()",                     DYPlayer.previous())                    \
+    X("next()",                         DYPlayer.next())                        \
+    X("playSpecified(1)",               DYPlayer.playSpecified(1))              \
+    X("playSpecifiedDevicePath()",      DYPlayer.playSpecifiedDevicePath(Sd, path)) \
+    X("setPlayingDevice(Sd)",           DYPlayer.setPlayingDevice(Sd))          \
+    X("previousDir(FirstSound)",        DYPlayer.previousDir(FirstSound))       \
+    X("setVolume(15)",                  DYPlayer.setVolume(15))                 \
+    X("volumeIncrease()",               DYPlayer.volumeIncrease())              \
+    X("volumeDecrease()",               DYPlayer.volumeDecrease())              \
+    X("interludeSpecified(Sd, 2)",      DYPlayer.interludeSpecified(Sd, 2))     \
+    X("interludeSpecifiedDevicePath()", DYPlayer.interludeSpecifiedDevicePath(Sd, path)) \
+    X("stopInterlude()",                DYPlayer.stopInterlude())               \
+    X("setCycleMode(OneOff)",           DYPlayer.setCycleMode(OneOff))          \
+    X("setCycleTimes(3)",               DYPlayer.setCycleTimes(3))              \
+    X("setEq(Normal)",                  DYPlayer.setEq(Normal))                 \
+    X("select(4)",                      DYPlayer.select(4))                     \
+    X("combinationPlay(3 sounds)",      DYPlayer.combinationPlay(sounds, 3))    \
+    X("endCombinationPlay()",           DYPlayer.endCombinationPlay())          \
+    X("checkPlayState()",               (void)DYPlayer.checkPlayState())        \
+    X("getPlayingDevice()",             (void)DYPlayer.getPlayingDevice())      \
+    X("getSoundCount()",                (void)DYPlayer.getSoundCount())         \
+    X("getPlayingSound()",              (void)DYPlayer.getPlayingSound())       \
+    X("getFirstInDir()",                (void)DYPlayer.getFirstInDir())         \
+    X("getSoundCountDir()",             (void)DYPlayer.getSoundCountDir())
+
+
+/*******************************************************************************
+  @func    : countWrite
+  @param   : void *ctx, const uint8_t *data, uint16_t len
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Count the write and its bytes, then send.
+********************************************************************************/
+static uint16_t countWrite(void *ctx, const uint8_t *data, uint16_t len) {
+    Counter_t *c = (Counter_t *)ctx;
+    uint16_t   n = DYTransport_Sim.write(&c->port, data, len);
+
+    c->writes++;
+    c->txBytes += n;
+    return n;
+}
+/*******************************************************************************
+  @func    : countRead
+  @param   : void *ctx, uint8_t *buffer, uint16_t len, uint32_t timeout
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Count the bytes received.
+********************************************************************************/
+static uint16_t countRead(void *ctx, uint8_t *buffer, uint16_t len, uint32_t timeout) {
+    Counter_t *c = (Counter_t *)ctx;
+    uint16_t   n = DYTransport_Sim.read(&c->port, buffer, len, timeout);
+
+    c->rxBytes += n;
+    return n;
+}
+/*******************************************************************************
+  @func    : countNow
+  @param   : void *ctx
+  @return  : uint32_t
+  @date	   : 16.10.26
+  @brief   : Simulator time.
+********************************************************************************/
+static uint32_t countNow(void *ctx) {
+    return DYTransport_Sim.now(&((Counter_t *)ctx)->port);
+}
+/*******************************************************************************
+  @func    : countWait
+  @param   : void *ctx, uint32_t us
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Simulator wait.
+********************************************************************************/
+static void countWait(void *ctx, uint32_t us) {
+    DYTransport_Sim.wait(&((Counter_t *)ctx)->port, us);
+}
+
+/* Blocking simulator transport with counters */
+static const DYTransport_st countTransport = {
+    countWrite,
+    countRead,
+    countNow,
+    countWait
+};
+
+/*******************************************************************************
+  @func    : measure
+  @param   : const char *label
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Print the counters of the call just made, then clear them and
+             let the module settle.
+********************************************************************************/
+static void measure(const char *label) {
+    printf("  %-32s %6u %8u %8u\n", label, (unsigned)counter.writes, (unsigned)counter.txBytes,
+           (unsigned)counter.rxBytes);
+    DYTransport_Sim.wait(&counter.port, 50000);
+    counter.writes  = 0;
+    counter.txBytes = 0;
+    counter.rxBytes = 0;
+}
+/*******************************************************************************
+  @func    : main
+  @param   : void
+  @return  : int
+  @date	   : 16.10.26
+  @brief   : Every call once on a fresh module.
+********************************************************************************/
+int main(void) {
+    DYSimConfig_t config;
+
+    DYSim_DefaultConfig(&config);
+    DYSim_Init(&sim, &config);
+    DYPortSim_Init(&counter.port, &sim, 0);
+    DYPlayer_Init(&player, &countTransport, &counter);
+
+    printf("  %-32s %6s %8s %8s\n", "call", "writes", "tx bytes", "rx bytes");
+#define BENCH_RUN(label, call)  call; measure(label);
+    BENCH_CALLS(BENCH_RUN)
+#undef BENCH_RUN
+
+    printf("module: %u frames, %u crc errors, %u unknown\n", (unsigned)sim.frames,
+           (unsigned)sim.crcErrors, (unsigned)sim.unknown);
+    return ((sim.crcErrors == 0) && (sim.unknown == 0)) ? 0 : 1;
+}
@@ -0,0 +1,271 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYGroup_Bench.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Start skew of a zone announcement on BENCH_ZONES simulated modules,
+  *          one UART each, all driven by one CPU. The skew is the spread of
+  *          the BUSY edges, i.e. of the moments audio came out:
+  *          - playSpecified() on every module in turn,
+  *          - DYGroup_Arm() and then DYGroup_Fire() on a timer tick,
+  *          each over blocking and over queued (DMA) transmit. On the queued
+  *          transports every UART still has 0 to BENCH_BACKLOG setVolume
+  *          frames of earlier traffic to send when the announcement starts.
+  *
+  *          gcc -std=c11 -O2 -IDYPlayer_Lib/inc -IDYPlayer_Lib/host $DY_SRC
+  *              DYPlayer_Lib/host/DYSim.c DYPlayer_Lib/host/DYPlayer_PortSim.c
+  *              DYPlayer_Lib/host/DYGroup_Bench.c -o dygroup_bench
+********************************************************************************/
+/************************************DEFINES***********************************/
+
+#define BENCH_ZONES         6       /* Modules, one per UART                   */
+#define BENCH_ROUNDS        500     /* Announcements measured per case         */
+#define BENCH_TRACK         7       /* Announcement track                      */
+#define BENCH_BACKLOG       3       /* Most frames queued on a UART before it  */
+#define BENCH_TICK_US       1000    /* Timer period firing the group           */
+#define BENCH_TX_QUEUE      64      /* Transport buffer of the DMA case        */
+
+/************************************INCLUDES***********************************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "DYPlayer.h"
+#include "DYPlayer_Group.h"
+#include "DYPlayer_PortSim.h"
+
+/**
+ * One zone: module, its UART and its driver instance.
+ */
+typedef struct
+{
+    DYSim_t     sim;
+    DYPortSim_t port;
+    DYPlayer_t  player;
+    uint64_t    startedAt;        /* First BUSY edge of the round, 0 = none     */
+} Zone_t;
+
+static Zone_t   zone[BENCH_ZONES];
+static uint64_t cpu;              /* Time of the one CPU driving every UART, ns */
+
+
+/*******************************************************************************
+  @func    : catchUp
+  @param   : void *ctx
+  @return  : DYPortSim_t *
+  @date	   : 16.10.26
+  @brief   : Bring a UART to the CPU time before it is used.
+********************************************************************************/
+static DYPortSim_t *catchUp(void *ctx) {
+    DYPortSim_t *port = (DYPortSim_t *)ctx;
+
+    DYPortSim_Run(port, cpu);
+    return port;
+}
+/*******************************************************************************
+  @func    : cpuWrite
+  @param   : void *ctx, const uint8_t *data, uint16_t len
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : DYTransport_Sim write at CPU time, a blocking write holds the CPU.
+********************************************************************************/
+static uint16_t cpuWrite(void *ctx, const uint8_t *data, uint16_t len) {
+    DYPortSim_t *port = catchUp(ctx);
+    uint16_t     n    = DYTransport_Sim.write(port, data, len);
+
+    cpu = port->now;
+    return n;
+}
+/*******************************************************************************
+  @func    : cpuRead
+  @param   : void *ctx, uint8_t *buffer, uint16_t len, uint32_t timeout
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : DYTransport_Sim read at CPU time, the CPU waits with it.
+********************************************************************************/
+static uint16_t cpuRead(void *ctx, uint8_t *buffer, uint16_t len, uint32_t timeout) {
+    DYPortSim_t *port = catchUp(ctx);
+    uint16_t     n    = DYTransport_Sim.read(port, buffer, len, timeout);
+
+    cpu = port->now;
+    return n;
+}
+/*******************************************************************************
+  @func    : cpuNow
+  @param   : void *ctx
+  @return  : uint32_t
+  @date	   : 16.10.26
+  @brief   : CPU time in us.
+********************************************************************************/
+static uint32_t cpuNow(void *ctx) {
+    (void)ctx;
+    return (uint32_t)(cpu / 1000U);
+}
+/*******************************************************************************
+  @func    : cpuWait
+  @param   : void *ctx, uint32_t us
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Let CPU time pass.
+********************************************************************************/
+static void cpuWait(void *ctx, uint32_t us) {
+    cpu += (uint64_t)us * 1000U;
+    catchUp(ctx);
+}
+
+/* Simulator UARTs on the shared CPU clock */
+static const DYTransport_st cpuTransport = {
+    cpuWrite,
+    cpuRead,
+    cpuNow,
+    cpuWait
+};
+
+/*******************************************************************************
+  @func    : onBusy
+  @param   : void *ctx, bool level, uint64_t time
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Note the first time audio came out of a zone.
+********************************************************************************/
+static void onBusy(void *ctx, bool level, uint64_t time) {
+    Zone_t *z = (Zone_t *)ctx;
+
+    if (!level && (z->startedAt == 0)) {
+        z->startedAt = time;
+    }
+}
+/*******************************************************************************
+  @func    : setup
+  @param   : uint16_t txQueue, DYGroup_t *group
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Fresh stopped modules, every zone in `group`. On queued transmit
+             each UART gets its random backlog of setVolume frames.
+********************************************************************************/
+static void setup(uint16_t txQueue, DYGroup_t *group) {
+    DYSimConfig_t config;
+
+    DYSim_DefaultConfig(&config);
+    DYGroup_Init(group);
+    cpu = 0;
+
+    for (int i = 0; i < BENCH_ZONES; i++) {
+        Zone_t *z = &zone[i];
+
+        DYSim_Init(&z->sim, &config);
+        DYSim_SetBusyCallback(&z->sim, onBusy, z);
+        DYPortSim_Init(&z->port, &z->sim, txQueue);
+        DYPlayer_Init(&z->player, &cpuTransport, &z->port);
+        DYGroup_Add(group, &z->player);
+        z->startedAt = 0;
+    }
+    cpuWait(&zone[0].port, 10000);
+
+    if (txQueue != 0) {
+        for (int i = 0; i < BENCH_ZONES; i++) {
+            for (int n = rand() % (BENCH_BACKLOG + 1); n > 0; n--) {
+                DYPlayer_SetVolume(&zone[i].player, (uint8_t)(10 + n));
+            }
+        }
+    }
+}
+/*******************************************************************************
+  @func    : skew
+  @param   : void
+  @return  : uint32_t
+  @date	   : 16.10.26
+  @brief   : Let every zone start, then the spread of the start times in us.
+             Checks every zone plays the announcement.
+********************************************************************************/
+static uint32_t skew(void) {
+    uint64_t first = UINT64_MAX;
+    uint64_t last  = 0;
+
+    cpu += 200000000ULL;
+    for (int i = 0; i < BENCH_ZONES; i++) {
+        Zone_t *z = &zone[i];
+
+        catchUp(&z->port);
+        if ((z->startedAt == 0) || (z->sim.track != BENCH_TRACK)) {
+            printf("zone %d did not start the announcement\n", i);
+        }
+        if (z->startedAt < first) first = z->startedAt;
+        if (z->startedAt > last)  last  = z->startedAt;
+    }
+    return (uint32_t)((last - first) / 1000U);
+}
+/*******************************************************************************
+  @func    : compare
+  @param   : const void *a, const void *b
+  @return  : int
+  @date	   : 16.10.26
+  @brief   : qsort order of skews.
+********************************************************************************/
+static int compare(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+/*******************************************************************************
+  @func    : run
+  @param   : uint16_t txQueue, bool grouped
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : BENCH_ROUNDS announcements, prints p50 and worst start skew.
+********************************************************************************/
+static void run(uint16_t txQueue, bool grouped) {
+    static uint32_t spread[BENCH_ROUNDS];
+    DYGroup_t       group;
+    uint32_t        fireUs = 0;
+
+    srand(1);
+    for (int r = 0; r < BENCH_ROUNDS; r++) {
+        setup(txQueue, &group);
+
+        if (grouped) {
+            if (!DYGroup_Arm(&group, BENCH_TRACK)) {
+                printf("round %d: arm failed\n", r);
+            }
+            /* Next timer tick */
+            cpu = ((cpu / (BENCH_TICK_US * 1000ULL)) + 1) * (BENCH_TICK_US * 1000ULL);
+            if (!DYGroup_Fire(&group)) {
+                printf("round %d: fire failed\n", r);
+            }
+            if (group.fireUs > fireUs) {
+                fireUs = group.fireUs;
+            }
+        } else {
+            for (int i = 0; i < BENCH_ZONES; i++) {
+                DYPlayer_PlaySpecified(&zone[i].player, BENCH_TRACK);
+            }
+        }
+        spread[r] = skew();
+    }
+
+    qsort(spread, BENCH_ROUNDS, sizeof(spread[0]), compare);
+    printf("  %-9s %-17s p50 %7.2f ms  max %7.2f ms", (txQueue == 0) ? "blocking" : "queued",
+           grouped ? "arm + fire" : "playSpecified", spread[BENCH_ROUNDS / 2] / 1e3,
+           spread[BENCH_ROUNDS - 1] / 1e3);
+    if (grouped) {
+        printf("  (fire %.2f ms)", fireUs / 1e3);
+    }
+    printf("\n");
+}
+/*******************************************************************************
+  @func    : main
+  @param   : void
+  @return  : int
+  @date	   : 16.10.26
+  @brief   : Every start method over blocking and queued transmit.
+********************************************************************************/
+int main(void) {
+    printf("start skew of %u zones, %u announcements\n", BENCH_ZONES, BENCH_ROUNDS);
+    run(0, false);
+    run(0, true);
+    run(BENCH_TX_QUEUE, false);
+    run(BENCH_TX_QUEUE, true);
+    return 0;
+}
@@ -0,0 +1,144 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYParser_Bench.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Parser throughput on the host: a stream of module answers is fed
+  *          byte by byte, clean and with every 100th byte corrupted.
+  *
+  *          gcc -std=c11 -O2 -IDYPlayer_Lib/inc DYPlayer_Lib/src/DYPlayer_Parser.c
+  *              DYPlayer_Lib/host/DYParser_Bench.c -o dyparser_bench
+********************************************************************************/
+/************************************DEFINES***********************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#define BENCH_FRAMES        2000000     /* Answers in the stream               */
+#define BENCH_ROUNDS        5           /* Best of                             */
+
+/************************************INCLUDES***********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "DYPlayer_Parser.h"
+
+
+static uint32_t handled;
+
+/*******************************************************************************
+  @func    : onFrame
+  @param   : void *ctx, uint8_t opcode, const uint8_t *data, uint8_t len
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Counting handler, keeps the dispatch in the measurement.
+********************************************************************************/
+static void onFrame(void *ctx, uint8_t opcode, const uint8_t *data, uint8_t len) {
+    (void)ctx;
+    (void)opcode;
+    (void)data;
+    (void)len;
+    handled++;
+}
+/*******************************************************************************
+  @func    : seconds
+  @param   : void
+  @return  : double
+  @date	   : 16.10.26
+  @brief   : Monotonic time stamp.
+********************************************************************************/
+static double seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+/*******************************************************************************
+  @func    : buildStream
+  @param   : uint8_t *stream
+  @return  : size_t
+  @date	   : 16.10.26
+  @brief   : Every answer the driver asks for, in turn: play state, device
+             (5 bytes) and the four 16 bit queries (6 bytes).
+********************************************************************************/
+static size_t buildStream(uint8_t *stream) {
+    static const uint8_t opcodes[] = { 0x01, 0x0A, 0x0C, 0x0D, 0x11, 0x12 };
+    size_t n = 0;
+
+    for (uint32_t i = 0; i < BENCH_FRAMES; i++) {
+        uint8_t opcode = opcodes[i % sizeof(opcodes)];
+        uint8_t len    = (opcode <= 0x0A) ? 1 : 2;
+        uint8_t sum    = 0;
+        size_t  start  = n;
+
+        stream[n++] = 0xAA;
+        stream[n++] = opcode;
+        stream[n++] = len;
+        for (uint8_t k = 0; k < len; k++) {
+            stream[n++] = (uint8_t)(i >> (8 * k));
+        }
+        for (size_t k = start; k < n; k++) {
+            sum += stream[k];
+        }
+        stream[n++] = sum;
+    }
+    return n;
+}
+/*******************************************************************************
+  @func    : run
+  @param   : const char *name, const uint8_t *stream, size_t len
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Best of BENCH_ROUNDS runs over the stream.
+********************************************************************************/
+static void run(const char *name, const uint8_t *stream, size_t len) {
+    static DYParser_t parser;
+    double            best = 1e9;
+
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        DYParser_Init(&parser);
+        for (uint8_t op = 0; op < DY_PARSER_OPCODES; op++) {
+            DYParser_SetHandler(&parser, op, onFrame, NULL);
+        }
+        handled = 0;
+
+        double t0 = seconds();
+        for (size_t i = 0; i < len; i++) {
+            DYParser_Feed(&parser, stream[i]);
+        }
+        double t = seconds() - t0;
+        if (t < best) {
+            best = t;
+        }
+    }
+
+    printf("%-10s %9u frames  %6.2f ns/byte  %7.2f Mframes/s  crc errors %u  skipped %u\n",
+           name, handled, best * 1e9 / len, handled / best / 1e6,
+           parser.crcErrors, parser.skipped);
+}
+/*******************************************************************************
+  @func    : main
+  @param   : void
+  @return  : int
+  @date	   : 16.10.26
+  @brief   : Clean stream, then the same stream with one byte in 100 flipped.
+********************************************************************************/
+int main(void) {
+    uint8_t *stream = malloc((size_t)BENCH_FRAMES * 6);
+    size_t   len;
+
+    if (stream == NULL) {
+        return 1;
+    }
+    len = buildStream(stream);
+    run("clean", stream, len);
+
+    for (size_t i = 50; i < len; i += 100) {
+        stream[i] ^= 0x5A;
+    }
+    run("1% noise", stream, len);
+
+    free(stream);
+    return 0;
+}
@@ -0,0 +1,115 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYParser_Fuzz.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 libFuzzer target of the response parser. Any input is fed byte by
+  *          byte, then checked:
+  *          - every dispatched frame has a consistent length and checksum,
+  *          - the parser never holds more than a frame of bytes,
+  *          - after the input, a run of valid answers is parsed again.
+  *
+  *          clang -std=c11 -g -O1 -fsanitize=fuzzer,address,undefined
+  *              -IDYPlayer_Lib/inc DYPlayer_Lib/src/DYPlayer_Parser.c
+  *              DYPlayer_Lib/host/DYParser_Fuzz.c -o dyparser_fuzz
+  *
+  *          Without libFuzzer add -DDY_FUZZ_STANDALONE, it then runs random
+  *          inputs: ./dyparser_fuzz [iterations]
+********************************************************************************/
+/************************************DEFINES***********************************/
+
+#define FUZZ_RESYNC_FRAMES  ((DY_FRAME_MAX / 5) + 2)   /* Enough to flush a frame */
+
+/************************************INCLUDES***********************************/
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "DYPlayer_Parser.h"
+
+
+static uint32_t delivered;
+
+/*******************************************************************************
+  @func    : check
+  @param   : void *ctx, uint8_t opcode, const uint8_t *data, uint8_t len
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Re-check every frame the parser hands out.
+********************************************************************************/
+static void check(void *ctx, uint8_t opcode, const uint8_t *data, uint8_t len) {
+    const DYParser_t *parser = (const DYParser_t *)ctx;
+    uint8_t           sum    = (uint8_t)(DY_FRAME_HEADER + opcode + len);
+
+    if ((parser->frame[0] != DY_FRAME_HEADER) || (parser->frame[1] != opcode) ||
+        (data != &parser->frame[3]) || (parser->len != (uint8_t)(len + DY_FRAME_OVERHEAD))) {
+        abort();
+    }
+    for (uint8_t i = 0; i < len; i++) {
+        sum += data[i];
+    }
+    if (sum != data[len]) {
+        abort();
+    }
+    delivered++;
+}
+/*******************************************************************************
+  @func    : LLVMFuzzerTestOneInput
+  @param   : const uint8_t *data, size_t size
+  @return  : int
+  @date	   : 16.10.26
+  @brief   : libFuzzer entry.
+********************************************************************************/
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    static const uint8_t answer[] = { 0xAA, 0x0D, 0x02, 0x00, 0x07, 0xC0 };
+    DYParser_t           parser;
+
+    DYParser_Init(&parser);
+    DYParser_SetFallback(&parser, check, &parser);
+    delivered = 0;
+
+    for (size_t i = 0; i < size; i++) {
+        DYParser_Feed(&parser, data[i]);
+        if ((parser.len > DY_FRAME_MAX) || (parser.replay > DY_FRAME_MAX)) {
+            abort();
+        }
+    }
+
+    /* Whatever the noise left behind, valid answers must come through. */
+    uint32_t before = delivered;
+    for (int n = 0; n < FUZZ_RESYNC_FRAMES; n++) {
+        DYParser_FeedBlock(&parser, answer, sizeof(answer));
+    }
+    if ((delivered - before) < 2) {
+        abort();
+    }
+    return 0;
+}
+
+#ifdef DY_FUZZ_STANDALONE
+/*******************************************************************************
+  @func    : main
+  @param   : int argc, char *argv[]
+  @return  : int
+  @date	   : 16.10.26
+  @brief   : Random inputs biased towards 0xAA and small lengths.
+********************************************************************************/
+int main(int argc, char *argv[]) {
+    long    iterations = (argc > 1) ? atol(argv[1]) : 1000000;
+    uint8_t input[256];
+
+    srand(1);
+    for (long it = 0; it < iterations; it++) {
+        size_t size = (size_t)(rand() % sizeof(input));
+        for (size_t i = 0; i < size; i++) {
+            int pick = rand() % 8;
+            input[i] = (pick == 0) ? 0xAA : (pick == 1) ? (uint8_t)(rand() % 4) : (uint8_t)rand();
+        }
+        LLVMFuzzerTestOneInput(input, size);
+    }
+    printf("%ld inputs ok\n", iterations);
+    return 0;
+}
+#endif
@@ -0,0 +1,80 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_HostExample.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Linux counterpart of the STM32 example: drives a module through a
+  *          serial device and prints how long every call took.
+  *
+  *          gcc -std=c11 -O2 -IDYPlayer_Lib/inc -IDYPlayer_Lib/host $DY_SRC
+  *              DYPlayer_Lib/host/DYPlayer_PortPOSIX.c
+  *              DYPlayer_Lib/host/DYPlayer_HostExample.c -o dyplayer_host
+  *
+  *          DY_SRC: the driver sources without the STM32 ports, see README.
+  *
+  *          ./dyplayer_host /dev/ttyUSB0 [loops]
+********************************************************************************/
+
+/************************************INCLUDES***********************************/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "DYPlayer.h"
+#include "DYPlayer_PortPOSIX.h"
+
+
+static DYPortPOSIX_t dyPort;
+static DYPlayer_t    dyPlayer;
+
+/*******************************************************************************
+  @func    : main
+  @param   : int argc, char *argv[]
+  @return  : int
+  @date	   : 16.10.26
+  @brief   : Same command loop as the STM32 example, timed per call.
+********************************************************************************/
+int main(int argc, char *argv[]) {
+    char path[] = "/00001.mp3";
+    int  loops  = (argc > 2) ? atoi(argv[2]) : 10;
+
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <tty> [loops]\n", argv[0]);
+        return 1;
+    }
+    if (!DYPortPOSIX_Open(&dyPort, argv[1], DY_POSIX_BAUD)) {
+        perror(argv[1]);
+        return 1;
+    }
+    DYPlayer_Init(&dyPlayer, &DYTransport_POSIX, &dyPort);
+
+    DYPlayer.setVolume(15);
+
+    for (int i = 0; i < loops; i++) {
+        uint32_t t0 = DYTransport_POSIX.now(&dyPort);
+        DYPlayer.playSpecifiedDevicePath(Sd, &path[0]);
+        uint32_t t1 = DYTransport_POSIX.now(&dyPort);
+        DYPlayer.play();
+        uint32_t t2 = DYTransport_POSIX.now(&dyPort);
+        play_state_t state = DYPlayer.checkPlayState();
+        uint32_t t3 = DYTransport_POSIX.now(&dyPort);
+        device_t device = DYPlayer.getPlayingDevice();
+        uint32_t t4 = DYTransport_POSIX.now(&dyPort);
+
+        printf("path %6lu us  play %6lu us  state %d %6lu us  device %3u %6lu us\n",
+               (unsigned long)(t1 - t0), (unsigned long)(t2 - t1),
+               (int)state, (unsigned long)(t3 - t2),
+               (unsigned)device, (unsigned long)(t4 - t3));
+
+        DYStatus_t status;
+        DYPlayer_Snapshot(&dyPlayer, &status);
+        printf("snapshot %6lu us  valid %02x  state %d device %u sound %u/%u dir %u+%u\n",
+               (unsigned long)status.elapsedUs, status.valid, (int)status.state,
+               (unsigned)status.device, status.sound, status.soundCount,
+               status.firstInDir, status.soundCountDir);
+    }
+
+    DYPortPOSIX_Close(&dyPort);
+    return 0;
+}
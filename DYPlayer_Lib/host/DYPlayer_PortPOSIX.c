@@ -0,0 +1,218 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_PortPOSIX.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Linux transport: a serial device or pseudo-terminal driven through
+  *          termios, timeouts handled by poll().
+********************************************************************************/
+/************************************DEFINES***********************************/
+
+#define _POSIX_C_SOURCE 200809L
+#define _DEFAULT_SOURCE             /* cfmakeraw()                             */
+
+/************************************INCLUDES***********************************/
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "DYPlayer_PortPOSIX.h"
+
+
+/*******************************************************************************
+  @func    : baudToSpeed
+  @param   : uint32_t baud
+  @return  : speed_t
+  @date	   : 16.10.26
+  @brief   : termios speed constant of a baud rate, B0 if not supported.
+********************************************************************************/
+static speed_t baudToSpeed(uint32_t baud) {
+    switch (baud) {
+        case 4800:   return B4800;
+        case 9600:   return B9600;
+        case 19200:  return B19200;
+        case 38400:  return B38400;
+        case 57600:  return B57600;
+        case 115200: return B115200;
+        default:     return B0;
+    }
+}
+/*******************************************************************************
+  @func    : DYPortPOSIX_Attach
+  @param   : DYPortPOSIX_t *port, int fd, uint32_t baud
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Take over an already open descriptor. A tty is switched to raw
+             8N1 at `baud`, anything else (pipe, socket) is used as it is.
+             The descriptor is made non-blocking, poll() does the waiting.
+********************************************************************************/
+bool DYPortPOSIX_Attach(DYPortPOSIX_t *port, int fd, uint32_t baud) {
+    struct termios tio;
+
+    port->fd = -1;
+
+    if (tcgetattr(fd, &tio) == 0) {
+        speed_t speed = baudToSpeed(baud);
+        if (speed == B0) {
+            return false;
+        }
+        cfmakeraw(&tio);
+        tio.c_cflag    |= CLOCAL | CREAD;
+        tio.c_cflag    &= ~(CSTOPB | PARENB | CRTSCTS);
+        tio.c_cc[VMIN]  = 0;
+        tio.c_cc[VTIME] = 0;
+        cfsetispeed(&tio, speed);
+        cfsetospeed(&tio, speed);
+        if (tcsetattr(fd, TCSANOW, &tio) != 0) {
+            return false;
+        }
+        tcflush(fd, TCIOFLUSH);
+    }
+
+    int flags = fcntl(fd, F_GETFL);
+    if ((flags < 0) || (fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0)) {
+        return false;
+    }
+
+    port->fd = fd;
+    return true;
+}
+/*******************************************************************************
+  @func    : DYPortPOSIX_Open
+  @param   : DYPortPOSIX_t *port, const char *device, uint32_t baud
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Open a serial device (/dev/ttyUSB0, a pty slave, ...) for the
+             module.
+********************************************************************************/
+bool DYPortPOSIX_Open(DYPortPOSIX_t *port, const char *device, uint32_t baud) {
+    int fd = open(device, O_RDWR | O_NOCTTY | O_NONBLOCK);
+
+    if (fd < 0) {
+        port->fd = -1;
+        return false;
+    }
+    if (!DYPortPOSIX_Attach(port, fd, baud)) {
+        close(fd);
+        return false;
+    }
+    return true;
+}
+/*******************************************************************************
+  @func    : DYPortPOSIX_Close
+  @param   : DYPortPOSIX_t *port
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Wait for pending output and close the device.
+********************************************************************************/
+void DYPortPOSIX_Close(DYPortPOSIX_t *port) {
+    if (port->fd < 0) {
+        return;
+    }
+    tcdrain(port->fd);
+    close(port->fd);
+    port->fd = -1;
+}
+/*******************************************************************************
+  @func    : posixNow
+  @param   : void *ctx
+  @return  : uint32_t
+  @date	   : 16.10.26
+  @brief   : Microseconds of the monotonic clock.
+********************************************************************************/
+static uint32_t posixNow(void *ctx) {
+    struct timespec ts;
+
+    (void)ctx;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000U + (uint64_t)ts.tv_nsec / 1000U);
+}
+/*******************************************************************************
+  @func    : posixWait
+  @param   : void *ctx, uint32_t us
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Sleep at least `us` microseconds.
+********************************************************************************/
+static void posixWait(void *ctx, uint32_t us) {
+    struct timespec ts;
+
+    (void)ctx;
+    ts.tv_sec  = us / 1000000U;
+    ts.tv_nsec = (long)(us % 1000000U) * 1000L;
+    while ((nanosleep(&ts, &ts) != 0) && (errno == EINTR)) {
+    }
+}
+/*******************************************************************************
+  @func    : posixWrite
+  @param   : void *ctx, const uint8_t *data, uint16_t len
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Write what the kernel buffer takes, 0 when it is full.
+********************************************************************************/
+static uint16_t posixWrite(void *ctx, const uint8_t *data, uint16_t len) {
+    DYPortPOSIX_t *port = (DYPortPOSIX_t *)ctx;
+    ssize_t        n;
+
+    do {
+        n = write(port->fd, data, len);
+    } while ((n < 0) && (errno == EINTR));
+
+    return (n > 0) ? (uint16_t)n : 0;
+}
+/*******************************************************************************
+  @func    : posixRead
+  @param   : void *ctx, uint8_t *buffer, uint16_t len, uint32_t timeout
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Collect up to `len` bytes, sleeping in poll() between chunks until
+             `timeout` microseconds are over.
+********************************************************************************/
+static uint16_t posixRead(void *ctx, uint8_t *buffer, uint16_t len, uint32_t timeout) {
+    DYPortPOSIX_t *port  = (DYPortPOSIX_t *)ctx;
+    uint32_t       start = posixNow(ctx);
+    uint16_t       got   = 0;
+
+    while (got < len) {
+        ssize_t n = read(port->fd, &buffer[got], len - got);
+        if (n > 0) {
+            got += (uint16_t)n;
+            continue;
+        }
+        if ((n < 0) && (errno != EAGAIN) && (errno != EINTR)) {
+            break;
+        }
+
+        uint32_t elapsed = posixNow(ctx) - start;
+        if (elapsed >= timeout) {
+            break;
+        }
+
+        /* poll() counts in ms, round up so short timeouts still sleep. */
+        struct pollfd pfd = { port->fd, POLLIN, 0 };
+        int           ms  = (int)((timeout - elapsed + 999U) / 1000U);
+        int           rc  = poll(&pfd, 1, ms);
+        if ((rc < 0) && (errno != EINTR)) {
+            break;
+        }
+        /* Other side gone (pty closed, USB adapter pulled). */
+        if ((rc > 0) && !(pfd.revents & POLLIN)) {
+            break;
+        }
+    }
+    return got;
+}
+
+/******************************************************************************/
+
+const DYTransport_st DYTransport_POSIX = {
+    posixWrite,
+    posixRead,
+    posixNow,
+    posixWait,
+};
@@ -0,0 +1,45 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_PortPOSIX.h
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Linux transport: a serial device or pseudo-terminal driven through
+  *          termios, timeouts handled by poll().
+********************************************************************************/
+#ifndef DYPLAYER_PORTPOSIX_H
+#define DYPLAYER_PORTPOSIX_H
+
+/************************************DEFINES***********************************/
+
+#define DY_POSIX_BAUD       9600    /* DY-XXXX modules only talk 9600 8N1      */
+
+/************************************INCLUDES***********************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "DYPlayer_Transport.h"
+
+/**
+ * Context of the POSIX transport, one per opened device.
+ */
+typedef struct
+{
+    int fd;                       /* Open tty, -1 when closed                  */
+} DYPortPOSIX_t;
+
+/**
+ * Function Declerations
+ */
+bool          DYPortPOSIX_Open(DYPortPOSIX_t *port, const char *device, uint32_t baud);
+bool          DYPortPOSIX_Attach(DYPortPOSIX_t *port, int fd, uint32_t baud);
+void          DYPortPOSIX_Close(DYPortPOSIX_t *port);
+
+/**
+ * Method pointer struct implementation
+ */
+extern const DYTransport_st DYTransport_POSIX;
+
+#endif /* DYPLAYER_PORTPOSIX_H */
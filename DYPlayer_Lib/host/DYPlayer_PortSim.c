@@ -0,0 +1,122 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_PortSim.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 In-process transport to a DYSim module on a virtual clock.
+********************************************************************************/
+
+/************************************INCLUDES***********************************/
+#include "DYPlayer_PortSim.h"
+
+
+/*******************************************************************************
+  @func    : DYPortSim_Init
+  @param   : DYPortSim_t *port, DYSim_t *sim, uint16_t txQueue
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Connect to a module, the clock starts where the module is.
+********************************************************************************/
+void DYPortSim_Init(DYPortSim_t *port, DYSim_t *sim, uint16_t txQueue) {
+    port->sim     = sim;
+    port->now     = sim->now;
+    port->txQueue = txQueue;
+}
+/*******************************************************************************
+  @func    : DYPortSim_Run
+  @param   : DYPortSim_t *port, uint64_t until
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Move the clock forward to `until` (ns), the module runs along.
+********************************************************************************/
+void DYPortSim_Run(DYPortSim_t *port, uint64_t until) {
+    if (until > port->now) {
+        port->now = until;
+    }
+    DYSim_Advance(port->sim, port->now);
+}
+/*******************************************************************************
+  @func    : simNow
+  @param   : void *ctx
+  @return  : uint32_t
+  @date	   : 16.10.26
+  @brief   : Virtual clock in microseconds.
+********************************************************************************/
+static uint32_t simNow(void *ctx) {
+    DYPortSim_t *port = (DYPortSim_t *)ctx;
+    return (uint32_t)(port->now / 1000U);
+}
+/*******************************************************************************
+  @func    : simWait
+  @param   : void *ctx, uint32_t us
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Let `us` microseconds of simulated time pass.
+********************************************************************************/
+static void simWait(void *ctx, uint32_t us) {
+    DYPortSim_t *port = (DYPortSim_t *)ctx;
+    DYPortSim_Run(port, port->now + (uint64_t)us * 1000U);
+}
+/*******************************************************************************
+  @func    : simWrite
+  @param   : void *ctx, const uint8_t *data, uint16_t len
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Blocking: the clock moves on until the last byte is on the wire.
+             Queued: take what fits into the MCU transmit buffer and return.
+********************************************************************************/
+static uint16_t simWrite(void *ctx, const uint8_t *data, uint16_t len) {
+    DYPortSim_t *port = (DYPortSim_t *)ctx;
+
+    DYSim_Advance(port->sim, port->now);
+
+    if (port->txQueue == 0) {
+        uint16_t n = DYSim_Write(port->sim, port->now, data, len);
+        DYPortSim_Run(port, port->sim->in.lineFree);
+        return n;
+    }
+
+    uint16_t pending = DYSim_InputPending(port->sim);
+    if (pending >= port->txQueue) {
+        return 0;
+    }
+    if (len > (port->txQueue - pending)) {
+        len = port->txQueue - pending;
+    }
+    return DYSim_Write(port->sim, port->now, data, len);
+}
+/*******************************************************************************
+  @func    : simRead
+  @param   : void *ctx, uint8_t *buffer, uint16_t len, uint32_t timeout
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Jump from event to event until `len` bytes came in or `timeout`
+             microseconds are over.
+********************************************************************************/
+static uint16_t simRead(void *ctx, uint8_t *buffer, uint16_t len, uint32_t timeout) {
+    DYPortSim_t *port     = (DYPortSim_t *)ctx;
+    uint64_t     deadline = port->now + (uint64_t)timeout * 1000U;
+    uint16_t     got      = 0;
+
+    for (;;) {
+        got += DYSim_Read(port->sim, port->now, &buffer[got], len - got);
+        if ((got >= len) || (port->now >= deadline)) {
+            break;
+        }
+
+        uint64_t next = DYSim_NextEvent(port->sim);
+        DYPortSim_Run(port, (next < deadline) ? next : deadline);
+    }
+    return got;
+}
+
+/******************************************************************************/
+
+const DYTransport_st DYTransport_Sim = {
+    simWrite,
+    simRead,
+    simNow,
+    simWait,
+};
@@ -0,0 +1,47 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_PortSim.h
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 In-process transport to a DYSim module on a virtual clock. Waiting
+  *          only moves the clock, so a run takes the simulated wire time but
+  *          no real time, and results repeat exactly.
+********************************************************************************/
+#ifndef DYPLAYER_PORTSIM_H
+#define DYPLAYER_PORTSIM_H
+
+/************************************INCLUDES***********************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "DYPlayer_Transport.h"
+#include "DYSim.h"
+
+/**
+ * Context of the simulator transport. `txQueue` models the MCU side: 0 is
+ * a blocking HAL_UART_Transmit (write returns when the last byte left),
+ * otherwise write returns at once while up to `txQueue` bytes are waiting
+ * for the wire, like the interrupt and DMA transports.
+ */
+typedef struct
+{
+    DYSim_t  *sim;
+    uint64_t  now;                /* Virtual clock, ns                         */
+    uint16_t  txQueue;            /* MCU transmit buffer, 0 = blocking         */
+} DYPortSim_t;
+
+/**
+ * Function Declerations
+ */
+void          DYPortSim_Init(DYPortSim_t *port, DYSim_t *sim, uint16_t txQueue);
+void          DYPortSim_Run(DYPortSim_t *port, uint64_t until);
+
+/**
+ * Method pointer struct implementation
+ */
+extern const DYTransport_st DYTransport_Sim;
+
+#endif /* DYPLAYER_PORTSIM_H */
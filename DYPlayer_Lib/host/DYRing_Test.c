@@ -0,0 +1,397 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYRing_Test.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Interrupt TX path on the host: DYRing_t filled by the producer,
+  *          drained by DYPlayer_UartIT_IRQHandler() on a fake USART
+  *          (fakehal/main.h). The test moves DR into the shift register one
+  *          byte time per step, sets TXE and TC like the peripheral and
+  *          calls the handler while an enabled flag is pending, followed
+  *          by the HAL's end of transmit check. Checks the bytes on the
+  *          wire, their order and count:
+  *          - frames of every length through the ring, past the 16 bit wrap
+  *            of the indexes,
+  *          - a full ring takes nothing of a frame that doesn't fit,
+  *          - serialWrite() / serialWrite_crc() of a driver instance, also
+  *            waiting for room in a full ring,
+  *          - an interrupt so late that TXE and TC are both pending leaves
+  *            the port idle and nothing for the HAL.
+  *
+  *          gcc -std=c11 -O2 -IDYPlayer_Lib/inc -IDYPlayer_Lib/host/fakehal
+  *              $DY_SRC DYPlayer_Lib/src/DYPlayer_UartIT.c
+  *              DYPlayer_Lib/host/DYRing_Test.c -o dyring_test
+********************************************************************************/
+/************************************DEFINES***********************************/
+
+#define TEST_BYTES          200000UL    /* Through the ring, > 65536       */
+#define TEST_WIRE_MAX       (TEST_BYTES + 1024)
+#define TEST_BYTE_US        1042        /* One byte time, 9600 8N1         */
+
+/************************************INCLUDES***********************************/
+#include <stdio.h>
+#include <string.h>
+
+#include "DYPlayer.h"
+#include "DYPlayer_UartIT.h"
+
+/**
+ * Fake USART: registers, shift register and the bytes that left.
+ */
+typedef struct
+{
+    USART_TypeDef      regs;
+    UART_HandleTypeDef huart;
+    bool               shifting;
+    uint8_t            shift;
+    uint8_t            wire[TEST_WIRE_MAX];
+    uint32_t           sent;
+    uint32_t           now;             /* us                                  */
+    uint32_t           halTxCplt;       /* TC taken by HAL_UART_IRQHandler     */
+} FakeUart_t;
+
+static FakeUart_t uart;
+static DYUartIT_t port;
+static int        failures;
+
+#define DR_EMPTY            0xFFFFFFFFUL    /* DR as the handler left it unwritten */
+#define CHECK(cond, ...)    do { if (!(cond)) { failures++; printf("  FAIL: " __VA_ARGS__); printf("\n"); } } while (0)
+
+
+/*******************************************************************************
+  @func    : fakeIrq
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : NVIC: run the handler while an enabled flag is pending. A DR
+             write clears TXE and TC like the peripheral does. TC left
+             pending with TCIE set is what HAL_UART_IRQHandler(), called
+             after the handler, takes as its own end of transmit.
+********************************************************************************/
+static void fakeIrq(void) {
+    for (;;) {
+        uint32_t sr  = uart.regs.SR;
+        uint32_t cr1 = uart.regs.CR1;
+
+        if (!(((sr & USART_SR_TXE) && (cr1 & USART_CR1_TXEIE)) ||
+              ((sr & USART_SR_TC) && (cr1 & USART_CR1_TCIE)))) {
+            return;
+        }
+        uart.regs.DR = DR_EMPTY;
+        DYPlayer_UartIT_IRQHandler(&port);
+        if ((uart.regs.SR & USART_SR_TC) && (uart.regs.CR1 & USART_CR1_TCIE)) {
+            uart.regs.CR1 &= ~USART_CR1_TCIE;
+            uart.halTxCplt++;
+        }
+        if (uart.regs.DR != DR_EMPTY) {
+            uart.regs.SR &= ~(USART_SR_TXE | USART_SR_TC);
+            if (!uart.shifting) {
+                /* Empty shift register takes DR at once. */
+                uart.shift      = (uint8_t)uart.regs.DR;
+                uart.shifting   = true;
+                uart.regs.SR   |= USART_SR_TXE;
+            }
+        } else if (uart.regs.CR1 == cr1) {
+            return;                     /* Handler left the flags pending */
+        }
+    }
+}
+/*******************************************************************************
+  @func    : fakeShift
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : One byte time: the shift register empties, DR moves in or TC
+             rises.
+********************************************************************************/
+static void fakeShift(void) {
+    uart.now += TEST_BYTE_US;
+    if (uart.shifting) {
+        if (uart.sent < TEST_WIRE_MAX) {
+            uart.wire[uart.sent] = uart.shift;
+        }
+        uart.sent++;
+        uart.shifting = false;
+    }
+    if ((uart.regs.SR & USART_SR_TXE) == 0U) {
+        uart.shift     = (uint8_t)uart.regs.DR;
+        uart.shifting  = true;
+        uart.regs.SR  |= USART_SR_TXE;
+    } else if (!uart.shifting) {
+        uart.regs.SR |= USART_SR_TC;
+    }
+}
+/*******************************************************************************
+  @func    : fakeStep
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : One byte time, then the interrupt runs.
+********************************************************************************/
+static void fakeStep(void) {
+    fakeShift();
+    fakeIrq();
+}
+/*******************************************************************************
+  @func    : drain
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Steps until the port went idle.
+********************************************************************************/
+static void drain(void) {
+    for (uint32_t i = 0; DYPlayer_UartIT_Busy(&port) && (i < 2 * TEST_WIRE_MAX); i++) {
+        fakeStep();
+    }
+    CHECK(!DYPlayer_UartIT_Busy(&port), "port still busy after drain");
+    CHECK(DYRing_Count(&port.tx) == 0U, "%u bytes left in the ring", DYRing_Count(&port.tx));
+    CHECK(uart.halTxCplt == 0U, "HAL took %u transmit ends", (unsigned)uart.halTxCplt);
+}
+/*******************************************************************************
+  @func    : reset
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Idle UART (TXE and TC set), empty port and wire.
+********************************************************************************/
+static void reset(void) {
+    memset(&uart, 0, sizeof(uart));
+    uart.huart.Instance = &uart.regs;
+    uart.regs.SR        = USART_SR_TXE | USART_SR_TC;
+    DYPlayer_UartIT_Init(&port, &uart.huart);
+}
+/*******************************************************************************
+  @func    : write
+  @param   : const uint8_t *data, uint16_t len
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : DYPlayer_UartIT_Write(), the TXEIE it sets fires right away.
+********************************************************************************/
+static bool write(const uint8_t *data, uint16_t len) {
+    bool ok = DYPlayer_UartIT_Write(&port, data, len);
+
+    fakeIrq();
+    return ok;
+}
+/*******************************************************************************
+  @func    : testWrap
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : TEST_BYTES in frames of 1 to DY_TX_RING_SIZE bytes, draining a
+             varying number of byte times in between. Retries a full ring.
+********************************************************************************/
+static void testWrap(void) {
+    static uint8_t expect[TEST_BYTES];
+    uint8_t        frame[DY_TX_RING_SIZE];
+    uint32_t       queued = 0;
+    uint32_t       seed   = 1;
+
+    printf("wrap-around, %lu bytes\n", TEST_BYTES);
+    reset();
+    while (queued < TEST_BYTES) {
+        seed = seed * 1103515245U + 12345U;
+
+        uint16_t len = (uint16_t)(1 + (seed >> 16) % DY_TX_RING_SIZE);
+
+        if (len > TEST_BYTES - queued) {
+            len = (uint16_t)(TEST_BYTES - queued);
+        }
+        for (uint16_t i = 0; i < len; i++) {
+            frame[i] = (uint8_t)((queued + i) * 7U + ((queued + i) >> 8));
+        }
+        while (!write(&frame[0], len)) {
+            CHECK(DYRing_Space(&port.tx) < len, "write refused with %u free", DYRing_Space(&port.tx));
+            fakeStep();
+        }
+        memcpy(&expect[queued], &frame[0], len);
+        queued += len;
+        for (uint32_t s = (seed >> 8) % 48; s > 0; s--) {
+            fakeStep();
+        }
+    }
+    drain();
+    CHECK(uart.sent == TEST_BYTES, "%u bytes on the wire", (unsigned)uart.sent);
+    CHECK(memcmp(&uart.wire[0], &expect[0], TEST_BYTES) == 0, "wire differs from what was queued");
+}
+/*******************************************************************************
+  @func    : testFull
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Stalled UART: the ring takes DY_TX_RING_SIZE bytes, refuses a
+             frame that doesn't fit whole, then delivers what it took.
+********************************************************************************/
+static void testFull(void) {
+    uint8_t  frame[5] = { 0xAA, 0x07, 0x02, 0x00, 0x01 };
+    uint8_t  expect[DY_TX_RING_SIZE + 2];
+    uint32_t queued   = 0;
+
+    printf("full ring\n");
+    reset();
+    /* First byte goes straight to the shift register, the second to DR. */
+    CHECK(write(&frame[0], 2), "first write refused");
+    memcpy(&expect[0], &frame[0], 2);
+    queued = 2;
+    while (DYRing_Space(&port.tx) >= sizeof(frame)) {
+        CHECK(write(&frame[0], sizeof(frame)), "write refused with room");
+        memcpy(&expect[queued], &frame[0], sizeof(frame));
+        queued += sizeof(frame);
+    }
+
+    uint16_t count = DYRing_Count(&port.tx);
+
+    CHECK(!write(&frame[0], sizeof(frame)), "frame accepted by a full ring");
+    CHECK(DYRing_Count(&port.tx) == count, "refused frame left %d bytes", DYRing_Count(&port.tx) - count);
+    while (DYRing_Space(&port.tx) > 0) {
+        CHECK(write(&frame[0], 1), "single byte refused with room");
+        expect[queued++] = frame[0];
+    }
+    CHECK(DYRing_Count(&port.tx) == DY_TX_RING_SIZE, "ring holds %u bytes", DYRing_Count(&port.tx));
+    CHECK(!write(&frame[0], 1), "byte accepted by a full ring");
+
+    drain();
+    CHECK(uart.sent == queued, "%u of %u bytes on the wire", (unsigned)uart.sent, (unsigned)queued);
+    CHECK(memcmp(&uart.wire[0], &expect[0], queued) == 0, "wire differs from what was queued");
+}
+/*******************************************************************************
+  @func    : itWrite
+  @param   : void *ctx, const uint8_t *data, uint16_t len
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Transport write of the interrupt port, like DYTransport_IT.
+********************************************************************************/
+static uint16_t itWrite(void *ctx, const uint8_t *data, uint16_t len) {
+    (void)ctx;
+    return write(data, len) ? len : 0;
+}
+/*******************************************************************************
+  @func    : itRead
+  @param   : void *ctx, uint8_t *buffer, uint16_t len, uint32_t timeout
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Nothing is ever received.
+********************************************************************************/
+static uint16_t itRead(void *ctx, uint8_t *buffer, uint16_t len, uint32_t timeout) {
+    (void)ctx;
+    (void)buffer;
+    (void)len;
+    (void)timeout;
+    return 0;
+}
+/*******************************************************************************
+  @func    : itNow
+  @param   : void *ctx
+  @return  : uint32_t
+  @date	   : 16.10.26
+  @brief   : Fake UART time in us.
+********************************************************************************/
+static uint32_t itNow(void *ctx) {
+    (void)ctx;
+    return uart.now;
+}
+/*******************************************************************************
+  @func    : itWait
+  @param   : void *ctx, uint32_t us
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Let the UART run for `us`.
+********************************************************************************/
+static void itWait(void *ctx, uint32_t us) {
+    (void)ctx;
+    for (uint32_t end = uart.now + us; (int32_t)(end - uart.now) > 0;) {
+        fakeStep();
+    }
+}
+
+/* Interrupt port behind a driver instance */
+static const DYTransport_st itTransport = {
+    itWrite,
+    itRead,
+    itNow,
+    itWait
+};
+
+/*******************************************************************************
+  @func    : testSerialWrite
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Frames as serialWrite() body plus serialWrite_crc(), enough of
+             them to fill the ring so the driver has to wait for room.
+********************************************************************************/
+static void testSerialWrite(void) {
+    static uint8_t expect[4 * 256];
+    DYPlayer_t     player;
+    uint32_t       queued = 0;
+
+    printf("serialWrite / serialWrite_crc\n");
+    reset();
+    DYPlayer_Init(&player, &itTransport, NULL);
+    DYPlayer_Use(&player);
+
+    for (uint16_t n = 0; n < 256; n++) {
+        uint8_t body[3] = { 0xAA, 0x13, (uint8_t)n };
+        uint8_t crc     = checksum(&body[0], sizeof(body));
+
+        serialWrite(&body[0], sizeof(body));
+        serialWrite_crc(crc);
+        memcpy(&expect[queued], &body[0], sizeof(body));
+        expect[queued + 3] = crc;
+        queued += 4;
+    }
+    drain();
+    CHECK(player.txDropped == 0, "%u writes dropped", (unsigned)player.txDropped);
+    CHECK(uart.sent == queued, "%u of %u bytes on the wire", (unsigned)uart.sent, (unsigned)queued);
+    CHECK(memcmp(&uart.wire[0], &expect[0], queued) == 0, "wire differs from what was written");
+}
+/*******************************************************************************
+  @func    : testLate
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : The TXE interrupt of the last byte is held off until the byte
+             left, TXE and TC are both pending when the handler runs. The
+             port has to go idle right there, with TCIE not left for the HAL.
+********************************************************************************/
+static void testLate(void) {
+    uint8_t frame[2] = { 0xAA, 0x02 };
+
+    printf("late interrupt\n");
+    reset();
+    CHECK(DYPlayer_UartIT_Write(&port, &frame[0], sizeof(frame)), "write refused");
+    /* One handler run: first byte to DR, the UART moves it on at once. */
+    fakeIrq();
+    while (DYRing_Count(&port.tx) > 0U) {
+        fakeStep();
+    }
+    /* Last byte in DR, interrupts masked until it and TC are through. */
+    for (int i = 0; i < 3; i++) {
+        fakeShift();
+    }
+    CHECK((uart.regs.SR & (USART_SR_TXE | USART_SR_TC)) == (USART_SR_TXE | USART_SR_TC),
+          "TXE and TC not both pending");
+    fakeIrq();
+    CHECK(!DYPlayer_UartIT_Busy(&port), "port still busy");
+    CHECK((uart.regs.CR1 & (USART_CR1_TXEIE | USART_CR1_TCIE)) == 0U, "interrupts left enabled");
+    CHECK(uart.halTxCplt == 0U, "HAL took %u transmit ends", (unsigned)uart.halTxCplt);
+    CHECK((uart.sent == sizeof(frame)) && (memcmp(&uart.wire[0], &frame[0], sizeof(frame)) == 0),
+          "wire differs from what was queued");
+}
+/*******************************************************************************
+  @func    : main
+  @param   : void
+  @return  : int
+  @date	   : 16.10.26
+  @brief   : Every case, non-zero exit on any failure.
+********************************************************************************/
+int main(void) {
+    testWrap();
+    testFull();
+    testSerialWrite();
+    testLate();
+    printf("%s, %d failures\n", (failures == 0) ? "ok" : "FAILED", failures);
+    return (failures == 0) ? 0 : 1;
+}
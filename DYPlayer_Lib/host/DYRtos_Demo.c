@@ -0,0 +1,240 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYRtos_Demo.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 DYPlayer_RTOS on the pthread shim: DEMO_CLIENTS tasks share one
+  *          simulated module through the driver task, each sending volume
+  *          and track changes and blocking on queries, at the same time.
+  *          The simulator runs on the real clock. Checks every answer, that
+  *          the module saw no broken or unknown frame, and prints the query
+  *          round trip seen by the clients.
+  *
+  *          gcc -std=c11 -O2 -pthread -DDY_RTOS=1 -IDYPlayer_Lib/inc
+  *              -IDYPlayer_Lib/host $DY_SRC DYPlayer_Lib/host/DYSim.c
+  *              DYPlayer_Lib/host/DYPlayer_PortSim.c DYPlayer_Lib/host/DYRtos_Posix.c
+  *              DYPlayer_Lib/host/DYRtos_Demo.c -o dyrtos_demo
+********************************************************************************/
+/************************************DEFINES***********************************/
+
+#define _POSIX_C_SOURCE     200809L
+
+#define DEMO_CLIENTS        4       /* Client tasks                            */
+#define DEMO_ROUNDS         20      /* Rounds per client                       */
+#define DEMO_TRACKS         40      /* Tracks on the simulated module          */
+#define DEMO_TX_QUEUE       64      /* Transport buffer, like the DMA port     */
+
+/************************************INCLUDES***********************************/
+#include <stdio.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "DYPlayer.h"
+#include "DYPlayer_RTOS.h"
+#include "DYPlayer_PortSim.h"
+
+/**
+ * Result of one client task.
+ */
+typedef struct
+{
+    int      id;
+    uint32_t queries;
+    uint32_t wrong;                   /* Answered with an unexpected value      */
+    uint32_t failed;                  /* Not queued or timed out                */
+    uint32_t worstMs;                 /* Longest query round trip               */
+} Client_t;
+
+static DYSimConfig_t   config;
+static DYSim_t         sim;
+static DYPortSim_t     port;
+static DYPlayer_t      player;
+static DYRtos_t        rtos;
+static Client_t        client[DEMO_CLIENTS];
+static QueueHandle_t   finished;
+static struct timespec epoch;
+
+
+/*******************************************************************************
+  @func    : realNs
+  @param   : void
+  @return  : uint64_t
+  @date	   : 16.10.26
+  @brief   : Monotonic ns since the demo started.
+********************************************************************************/
+static uint64_t realNs(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)(ts.tv_sec - epoch.tv_sec) * 1000000000ULL + (uint64_t)ts.tv_nsec -
+           (uint64_t)epoch.tv_nsec;
+}
+/*******************************************************************************
+  @func    : catchUp
+  @param   : void *ctx
+  @return  : DYPortSim_t *
+  @date	   : 16.10.26
+  @brief   : Bring the module to the real time before it is used.
+********************************************************************************/
+static DYPortSim_t *catchUp(void *ctx) {
+    DYPortSim_t *p = (DYPortSim_t *)ctx;
+
+    DYPortSim_Run(p, realNs());
+    return p;
+}
+/*******************************************************************************
+  @func    : realWrite
+  @param   : void *ctx, const uint8_t *data, uint16_t len
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : DYTransport_Sim write at real time.
+********************************************************************************/
+static uint16_t realWrite(void *ctx, const uint8_t *data, uint16_t len) {
+    return DYTransport_Sim.write(catchUp(ctx), data, len);
+}
+/*******************************************************************************
+  @func    : realRead
+  @param   : void *ctx, uint8_t *buffer, uint16_t len, uint32_t timeout
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : DYTransport_Sim read at real time, only what already arrived.
+********************************************************************************/
+static uint16_t realRead(void *ctx, uint8_t *buffer, uint16_t len, uint32_t timeout) {
+    (void)timeout;
+    return DYTransport_Sim.read(catchUp(ctx), buffer, len, 0);
+}
+/*******************************************************************************
+  @func    : realNow
+  @param   : void *ctx
+  @return  : uint32_t
+  @date	   : 16.10.26
+  @brief   : Real time in us.
+********************************************************************************/
+static uint32_t realNow(void *ctx) {
+    (void)ctx;
+    return (uint32_t)(realNs() / 1000U);
+}
+/*******************************************************************************
+  @func    : realWait
+  @param   : void *ctx, uint32_t us
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Sleep, the module keeps running with the clock.
+********************************************************************************/
+static void realWait(void *ctx, uint32_t us) {
+    (void)ctx;
+    vTaskDelay(pdMS_TO_TICKS((us + 999U) / 1000U));
+}
+
+/* Simulator on the real clock */
+static const DYTransport_st realTransport = {
+    realWrite,
+    realRead,
+    realNow,
+    realWait
+};
+
+/*******************************************************************************
+  @func    : query
+  @param   : Client_t *c, uint8_t index, uint16_t low, uint16_t high
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : One blocking query, the answer must be within [low, high].
+********************************************************************************/
+static void query(Client_t *c, uint8_t index, uint16_t low, uint16_t high) {
+    TickType_t start = xTaskGetTickCount();
+    uint16_t   value = 0;
+
+    c->queries++;
+    if (!DYRtos_Control(&rtos, index, &value, portMAX_DELAY)) {
+        c->failed++;
+        return;
+    }
+    if ((value < low) || (value > high)) {
+        c->wrong++;
+    }
+
+    uint32_t ms = xTaskGetTickCount() - start;
+
+    if (ms > c->worstMs) {
+        c->worstMs = ms;
+    }
+}
+/*******************************************************************************
+  @func    : clientTask
+  @param   : void *param
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DEMO_ROUNDS of commands and queries, then report to main.
+********************************************************************************/
+static void clientTask(void *param) {
+    Client_t *c = (Client_t *)param;
+
+    for (int r = 0; r < DEMO_ROUNDS; r++) {
+        uint16_t track = (uint16_t)(1 + (c->id * DEMO_ROUNDS + r) % DEMO_TRACKS);
+
+        if (!DYRtos_SetVolume(&rtos, (uint8_t)(10 + c->id), portMAX_DELAY) ||
+            !DYRtos_PlaySpecified(&rtos, track, portMAX_DELAY)) {
+            c->failed++;
+        }
+        query(c, QNUMBEROFSONG_CMD, DEMO_TRACKS, DEMO_TRACKS);
+        query(c, QCURRENTSONG_CMD, 1, DEMO_TRACKS);
+        query(c, QCURRENTPLAY_CMD, config.device, config.device);
+    }
+    xQueueSend(finished, &c, portMAX_DELAY);
+    for (;;) {
+        vTaskDelay(portMAX_DELAY);
+    }
+}
+/*******************************************************************************
+  @func    : main
+  @param   : void
+  @return  : int
+  @date	   : 16.10.26
+  @brief   : Start the driver task and the clients, wait for every client.
+********************************************************************************/
+int main(void) {
+    uint32_t total  = 0;
+    uint32_t errors = 0;
+    uint32_t worst  = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &epoch);
+    DYSim_DefaultConfig(&config);
+    config.trackCount = DEMO_TRACKS;
+    DYSim_Init(&sim, &config);
+    DYPortSim_Init(&port, &sim, DEMO_TX_QUEUE);
+    DYPlayer_Init(&player, &realTransport, &port);
+
+    finished = xQueueCreate(DEMO_CLIENTS, sizeof(Client_t *));
+    if ((finished == NULL) || !DYRtos_Start(&rtos, &player)) {
+        printf("start failed\n");
+        return 1;
+    }
+    for (int i = 0; i < DEMO_CLIENTS; i++) {
+        client[i].id = i;
+        xTaskCreate(clientTask, "client", 256, &client[i], tskIDLE_PRIORITY + 1, NULL);
+    }
+
+    for (int i = 0; i < DEMO_CLIENTS; i++) {
+        Client_t *c;
+
+        xQueueReceive(finished, &c, portMAX_DELAY);
+        printf("client %d: %u queries, %u wrong, %u failed, worst %u ms\n", c->id,
+               (unsigned)c->queries, (unsigned)c->wrong, (unsigned)c->failed, (unsigned)c->worstMs);
+        total  += c->queries;
+        errors += c->wrong + c->failed;
+        if (c->worstMs > worst) {
+            worst = c->worstMs;
+        }
+    }
+
+    printf("%u queries from %u tasks, %u errors, worst round trip %u ms\n", (unsigned)total,
+           DEMO_CLIENTS, (unsigned)errors, (unsigned)worst);
+    printf("module: %u frames, %u crc errors, %u unknown, %u dropped\n", (unsigned)sim.frames,
+           (unsigned)sim.crcErrors, (unsigned)sim.unknown, (unsigned)sim.dropped);
+    printf("driver: %u messages, %u coalesced, %u resent, %u timeouts\n", (unsigned)rtos.messages,
+           (unsigned)rtos.async.coalesced, (unsigned)rtos.async.resent, (unsigned)rtos.async.timeouts);
+    return ((errors == 0) && (sim.crcErrors == 0) && (sim.unknown == 0)) ? 0 : 1;
+}
@@ -0,0 +1,476 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYRtos_Posix.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 FreeRTOS shim on POSIX threads, see FreeRTOS.h. Notifications
+  *          follow the FreeRTOS rules: Give/Take count on the notification
+  *          value, Notify/Wait use the pending state.
+********************************************************************************/
+/************************************DEFINES***********************************/
+
+#define _POSIX_C_SOURCE     200809L
+
+/************************************INCLUDES***********************************/
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+/**
+ * Task, one thread.
+ */
+struct tskTaskControlBlock
+{
+    pthread_t       thread;
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+    uint32_t        value;            /* Notification value                    */
+    bool            pending;          /* Notified, not taken yet               */
+    TaskFunction_t  code;
+    void           *param;
+};
+
+/**
+ * Queue, ring of `length` items.
+ */
+struct QueueDefinition
+{
+    pthread_mutex_t lock;
+    pthread_cond_t  changed;
+    uint8_t        *items;
+    UBaseType_t     length;
+    UBaseType_t     itemSize;
+    UBaseType_t     head;
+    UBaseType_t     count;
+};
+
+static _Thread_local TaskHandle_t current;
+static pthread_mutex_t            critical = PTHREAD_MUTEX_INITIALIZER;
+
+
+/*******************************************************************************
+  @func    : initCond
+  @param   : pthread_cond_t *cond
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Condition variable timed on the monotonic clock.
+********************************************************************************/
+static void initCond(pthread_cond_t *cond) {
+    pthread_condattr_t attr;
+
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(cond, &attr);
+    pthread_condattr_destroy(&attr);
+}
+/*******************************************************************************
+  @func    : deadline
+  @param   : TickType_t ticks
+  @return  : struct timespec
+  @date	   : 16.10.26
+  @brief   : Monotonic time `ticks` from now.
+********************************************************************************/
+static struct timespec deadline(TickType_t ticks) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    ts.tv_sec  += ticks / configTICK_RATE_HZ;
+    ts.tv_nsec += (long)(ticks % configTICK_RATE_HZ) * (1000000000L / configTICK_RATE_HZ);
+    if (ts.tv_nsec >= 1000000000L) {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000L;
+    }
+    return ts;
+}
+/*******************************************************************************
+  @func    : wait
+  @param   : pthread_cond_t *cond, pthread_mutex_t *lock, TickType_t ticks,
+             const struct timespec *until
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : One wait on `cond`, false once `until` passed. portMAX_DELAY
+             waits forever, 0 does not wait.
+********************************************************************************/
+static bool wait(pthread_cond_t *cond, pthread_mutex_t *lock, TickType_t ticks,
+                 const struct timespec *until) {
+    if (ticks == 0) {
+        return false;
+    }
+    if (ticks == portMAX_DELAY) {
+        return pthread_cond_wait(cond, lock) == 0;
+    }
+    return pthread_cond_timedwait(cond, lock, until) == 0;
+}
+/*******************************************************************************
+  @func    : newTask
+  @param   : TaskFunction_t code, void *param
+  @return  : TaskHandle_t
+  @date	   : 16.10.26
+  @brief   : Allocate a task control block, NULL when out of memory.
+********************************************************************************/
+static TaskHandle_t newTask(TaskFunction_t code, void *param) {
+    TaskHandle_t task = calloc(1, sizeof(*task));
+
+    if (task != NULL) {
+        pthread_mutex_init(&task->lock, NULL);
+        initCond(&task->cond);
+        task->code  = code;
+        task->param = param;
+    }
+    return task;
+}
+/*******************************************************************************
+  @func    : taskEntry
+  @param   : void *arg
+  @return  : void *
+  @date	   : 16.10.26
+  @brief   : Thread body of a task.
+********************************************************************************/
+static void *taskEntry(void *arg) {
+    current = (TaskHandle_t)arg;
+    current->code(current->param);
+    return NULL;
+}
+/*******************************************************************************
+  @func    : xTaskCreate
+  @param   : TaskFunction_t code, const char *name, uint16_t stackDepth,
+             void *param, UBaseType_t priority, TaskHandle_t *created
+  @return  : BaseType_t
+  @date	   : 16.10.26
+  @brief   : Start `code` on a new detached thread.
+********************************************************************************/
+BaseType_t xTaskCreate(TaskFunction_t code, const char *name, uint16_t stackDepth,
+                       void *param, UBaseType_t priority, TaskHandle_t *created) {
+    TaskHandle_t task = newTask(code, param);
+
+    (void)name;
+    (void)stackDepth;
+    (void)priority;
+    if (task == NULL) {
+        return pdFAIL;
+    }
+    if (created != NULL) {
+        *created = task;
+    }
+    if (pthread_create(&task->thread, NULL, taskEntry, task) != 0) {
+        return pdFAIL;
+    }
+    pthread_detach(task->thread);
+    return pdPASS;
+}
+/*******************************************************************************
+  @func    : xTaskGetCurrentTaskHandle
+  @param   : void
+  @return  : TaskHandle_t
+  @date	   : 16.10.26
+  @brief   : Task of the calling thread, made on first use for other threads.
+********************************************************************************/
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    if (current == NULL) {
+        current = newTask(NULL, NULL);
+        if (current != NULL) {
+            current->thread = pthread_self();
+        }
+    }
+    return current;
+}
+/*******************************************************************************
+  @func    : xTaskGetTickCount
+  @param   : void
+  @return  : TickType_t
+  @date	   : 16.10.26
+  @brief   : Monotonic time in ticks.
+********************************************************************************/
+TickType_t xTaskGetTickCount(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (TickType_t)((uint64_t)ts.tv_sec * configTICK_RATE_HZ +
+                        (uint64_t)ts.tv_nsec / (1000000000UL / configTICK_RATE_HZ));
+}
+/*******************************************************************************
+  @func    : vTaskDelay
+  @param   : TickType_t ticks
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Sleep `ticks`.
+********************************************************************************/
+void vTaskDelay(TickType_t ticks) {
+    struct timespec ts = deadline(ticks);
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) != 0) {
+    }
+}
+/*******************************************************************************
+  @func    : xTaskNotify
+  @param   : TaskHandle_t task, uint32_t value, eNotifyAction action
+  @return  : BaseType_t
+  @date	   : 16.10.26
+  @brief   : Update the notification value of `task` and mark it pending.
+             pdFAIL only for eSetValueWithoutOverwrite on a pending one.
+********************************************************************************/
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action) {
+    BaseType_t result = pdPASS;
+
+    pthread_mutex_lock(&task->lock);
+    switch (action) {
+    case eSetBits:
+        task->value |= value;
+        break;
+    case eIncrement:
+        task->value++;
+        break;
+    case eSetValueWithOverwrite:
+        task->value = value;
+        break;
+    case eSetValueWithoutOverwrite:
+        if (task->pending) {
+            result = pdFAIL;
+        } else {
+            task->value = value;
+        }
+        break;
+    case eNoAction:
+    default:
+        break;
+    }
+    task->pending = true;
+    pthread_cond_broadcast(&task->cond);
+    pthread_mutex_unlock(&task->lock);
+    return result;
+}
+/*******************************************************************************
+  @func    : xTaskNotifyGive
+  @param   : TaskHandle_t task
+  @return  : BaseType_t
+  @date	   : 16.10.26
+  @brief   : Increment the notification value of `task`.
+********************************************************************************/
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    return xTaskNotify(task, 0, eIncrement);
+}
+/*******************************************************************************
+  @func    : vTaskNotifyGiveFromISR
+  @param   : TaskHandle_t task, BaseType_t *woken
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : xTaskNotifyGive() from a signal or callback thread.
+********************************************************************************/
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken) {
+    xTaskNotifyGive(task);
+    if (woken != NULL) {
+        *woken = pdTRUE;
+    }
+}
+/*******************************************************************************
+  @func    : ulTaskNotifyTake
+  @param   : BaseType_t clearOnExit, TickType_t ticks
+  @return  : uint32_t
+  @date	   : 16.10.26
+  @brief   : Wait up to `ticks` for a non-zero notification value. Returns it,
+             then clears it or takes one off. 0 on timeout.
+********************************************************************************/
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks) {
+    TaskHandle_t    task  = xTaskGetCurrentTaskHandle();
+    struct timespec until = deadline(ticks);
+    uint32_t        value;
+
+    pthread_mutex_lock(&task->lock);
+    while ((task->value == 0) && wait(&task->cond, &task->lock, ticks, &until)) {
+    }
+    value = task->value;
+    if (value != 0) {
+        task->value = (clearOnExit != pdFALSE) ? 0 : (value - 1);
+    }
+    task->pending = false;
+    pthread_mutex_unlock(&task->lock);
+    return value;
+}
+/*******************************************************************************
+  @func    : xTaskNotifyWait
+  @param   : uint32_t clearOnEntry, uint32_t clearOnExit, uint32_t *value,
+             TickType_t ticks
+  @return  : BaseType_t
+  @date	   : 16.10.26
+  @brief   : Wait up to `ticks` for a pending notification, its value goes to
+             `value`. pdFALSE on timeout.
+********************************************************************************/
+BaseType_t xTaskNotifyWait(uint32_t clearOnEntry, uint32_t clearOnExit, uint32_t *value,
+                           TickType_t ticks) {
+    TaskHandle_t    task  = xTaskGetCurrentTaskHandle();
+    struct timespec until = deadline(ticks);
+    bool            got;
+
+    pthread_mutex_lock(&task->lock);
+    if (!task->pending) {
+        task->value &= ~clearOnEntry;
+    }
+    while (!task->pending && wait(&task->cond, &task->lock, ticks, &until)) {
+    }
+    if (value != NULL) {
+        *value = task->value;
+    }
+    got = task->pending;
+    if (got) {
+        task->value &= ~clearOnExit;
+    }
+    task->pending = false;
+    pthread_mutex_unlock(&task->lock);
+    return got ? pdTRUE : pdFALSE;
+}
+/*******************************************************************************
+  @func    : xTaskNotifyStateClear
+  @param   : TaskHandle_t task
+  @return  : BaseType_t
+  @date	   : 16.10.26
+  @brief   : Drop a pending notification of `task`, NULL for the calling
+             task. pdTRUE when one was pending.
+********************************************************************************/
+BaseType_t xTaskNotifyStateClear(TaskHandle_t task) {
+    bool was;
+
+    if (task == NULL) {
+        task = xTaskGetCurrentTaskHandle();
+    }
+    pthread_mutex_lock(&task->lock);
+    was           = task->pending;
+    task->pending = false;
+    pthread_mutex_unlock(&task->lock);
+    return was ? pdTRUE : pdFALSE;
+}
+/*******************************************************************************
+  @func    : ulTaskNotifyValueClear
+  @param   : TaskHandle_t task, uint32_t bits
+  @return  : uint32_t
+  @date	   : 16.10.26
+  @brief   : Clear `bits` of the notification value of `task`, NULL for the
+             calling task. Returns the value before.
+********************************************************************************/
+uint32_t ulTaskNotifyValueClear(TaskHandle_t task, uint32_t bits) {
+    uint32_t value;
+
+    if (task == NULL) {
+        task = xTaskGetCurrentTaskHandle();
+    }
+    pthread_mutex_lock(&task->lock);
+    value        = task->value;
+    task->value &= ~bits;
+    pthread_mutex_unlock(&task->lock);
+    return value;
+}
+/*******************************************************************************
+  @func    : vTaskEnterCritical
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : taskENTER_CRITICAL(), one global lock. Not nestable.
+********************************************************************************/
+void vTaskEnterCritical(void) {
+    pthread_mutex_lock(&critical);
+}
+/*******************************************************************************
+  @func    : vTaskExitCritical
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : taskEXIT_CRITICAL().
+********************************************************************************/
+void vTaskExitCritical(void) {
+    pthread_mutex_unlock(&critical);
+}
+/*******************************************************************************
+  @func    : xQueueCreate
+  @param   : UBaseType_t length, UBaseType_t itemSize
+  @return  : QueueHandle_t
+  @date	   : 16.10.26
+  @brief   : Empty queue of `length` items, NULL when out of memory.
+********************************************************************************/
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+    QueueHandle_t queue = calloc(1, sizeof(*queue));
+
+    if (queue == NULL) {
+        return NULL;
+    }
+    queue->items = malloc(length * itemSize);
+    if (queue->items == NULL) {
+        free(queue);
+        return NULL;
+    }
+    pthread_mutex_init(&queue->lock, NULL);
+    initCond(&queue->changed);
+    queue->length   = length;
+    queue->itemSize = itemSize;
+    return queue;
+}
+/*******************************************************************************
+  @func    : xQueueSend
+  @param   : QueueHandle_t queue, const void *item, TickType_t ticks
+  @return  : BaseType_t
+  @date	   : 16.10.26
+  @brief   : Copy `item` to the back, waiting up to `ticks` for room.
+********************************************************************************/
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks) {
+    struct timespec until = deadline(ticks);
+    BaseType_t      result = pdFAIL;
+
+    pthread_mutex_lock(&queue->lock);
+    while ((queue->count == queue->length) && wait(&queue->changed, &queue->lock, ticks, &until)) {
+    }
+    if (queue->count < queue->length) {
+        UBaseType_t slot = (queue->head + queue->count) % queue->length;
+
+        memcpy(&queue->items[slot * queue->itemSize], item, queue->itemSize);
+        queue->count++;
+        pthread_cond_broadcast(&queue->changed);
+        result = pdPASS;
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return result;
+}
+/*******************************************************************************
+  @func    : xQueueReceive
+  @param   : QueueHandle_t queue, void *item, TickType_t ticks
+  @return  : BaseType_t
+  @date	   : 16.10.26
+  @brief   : Copy the front item out, waiting up to `ticks` for one.
+********************************************************************************/
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks) {
+    struct timespec until = deadline(ticks);
+    BaseType_t      result = pdFAIL;
+
+    pthread_mutex_lock(&queue->lock);
+    while ((queue->count == 0) && wait(&queue->changed, &queue->lock, ticks, &until)) {
+    }
+    if (queue->count > 0) {
+        memcpy(item, &queue->items[queue->head * queue->itemSize], queue->itemSize);
+        queue->head = (queue->head + 1) % queue->length;
+        queue->count--;
+        pthread_cond_broadcast(&queue->changed);
+        result = pdPASS;
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return result;
+}
+/*******************************************************************************
+  @func    : uxQueueMessagesWaiting
+  @param   : QueueHandle_t queue
+  @return  : UBaseType_t
+  @date	   : 16.10.26
+  @brief   : Items in the queue.
+********************************************************************************/
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    UBaseType_t count;
+
+    pthread_mutex_lock(&queue->lock);
+    count = queue->count;
+    pthread_mutex_unlock(&queue->lock);
+    return count;
+}
@@ -0,0 +1,239 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYRxQueue_Stress.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 DYRxQueue_t with producer and consumer on two threads, free
+  *          running on separate cores, STRESS_FRAMES frames per case:
+  *          - lossless: the producer retries a full queue,
+  *          - lossy: it drops the frame like the UART interrupt does.
+  *          A side that keeps finding the queue full or empty sleeps a
+  *          moment, so the run also finishes on a single core.
+  *          Every frame carries its sequence number and a checksum, frames
+  *          alternate between the copying and the in place calls. The
+  *          consumer checks every frame is intact, in order, and (lossy)
+  *          that received + dropped adds up to sent.
+  *
+  *          gcc -std=c11 -O2 -pthread -IDYPlayer_Lib/inc
+  *              DYPlayer_Lib/src/DYPlayer_RxQueue.c
+  *              DYPlayer_Lib/host/DYRxQueue_Stress.c -o dyrxq_stress
+  *
+  *          On one core the 8 frame default queue runs at the speed of the
+  *          sleeps (minutes); -DDY_RXQ_LEN=1024 takes about a second.
+********************************************************************************/
+/************************************DEFINES***********************************/
+
+#define _POSIX_C_SOURCE     200809L
+
+#ifndef STRESS_FRAMES
+#define STRESS_FRAMES       10000000UL  /* Frames sent per case            */
+#endif
+#define STRESS_SPINS        64          /* Tries before a side sleeps      */
+#define STRESS_SLEEP_NS     20000       /* Sleep on a full / empty queue   */
+
+/************************************INCLUDES***********************************/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "DYPlayer_RxQueue.h"
+
+/**
+ * One case.
+ */
+typedef struct
+{
+    DYRxQueue_t queue;
+    bool        lossy;
+    volatile bool done;               /* Producer finished, set with release   */
+    uint32_t    received;
+    uint32_t    corrupt;              /* Bad header, length or checksum        */
+    uint32_t    misordered;           /* Sequence went back or, lossless, skipped */
+} Stress_t;
+
+
+/*******************************************************************************
+  @func    : backoff
+  @param   : uint32_t *spins
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Called on a full or empty queue, sleeps every STRESS_SPINS calls.
+********************************************************************************/
+static void backoff(uint32_t *spins) {
+    static const struct timespec pause = { 0, STRESS_SLEEP_NS };
+
+    if (++*spins >= STRESS_SPINS) {
+        *spins = 0;
+        nanosleep(&pause, NULL);
+    }
+}
+/*******************************************************************************
+  @func    : build
+  @param   : uint8_t *frame, uint32_t seq
+  @return  : uint8_t
+  @date	   : 16.10.26
+  @brief   : Answer frame carrying `seq`: 4 sequence bytes and up to
+             DY_PARSER_MAX_DATA - 4 filler bytes, the length varies with it.
+********************************************************************************/
+static uint8_t build(uint8_t *frame, uint32_t seq) {
+    uint8_t data = (uint8_t)(4 + seq % (DY_PARSER_MAX_DATA - 3));
+    uint8_t sum  = 0;
+    uint8_t len  = 0;
+
+    frame[len++] = 0xAA;
+    frame[len++] = (uint8_t)(seq & 0x1F);
+    frame[len++] = data;
+    for (uint8_t i = 0; i < data; i++) {
+        frame[len++] = (i < 4) ? (uint8_t)(seq >> (8 * i)) : (uint8_t)(seq + i);
+    }
+    for (uint8_t i = 0; i < len; i++) {
+        sum += frame[i];
+    }
+    frame[len++] = sum;
+    return len;
+}
+/*******************************************************************************
+  @func    : producer
+  @param   : void *arg
+  @return  : void *
+  @date	   : 16.10.26
+  @brief   : Send STRESS_FRAMES frames, even ones in place, odd ones copied.
+********************************************************************************/
+static void *producer(void *arg) {
+    Stress_t *s = (Stress_t *)arg;
+    uint8_t   frame[DY_RXQ_FRAME_SIZE];
+    uint32_t  spins = 0;
+
+    for (uint32_t seq = 0; seq < STRESS_FRAMES; seq++) {
+        uint8_t len = build(&frame[0], seq);
+
+        for (;;) {
+            bool sent;
+
+            if ((seq & 1U) == 0) {
+                DYRxFrame_t *slot = DYRxQueue_Reserve(&s->queue);
+
+                sent = (slot != NULL);
+                if (sent) {
+                    memcpy(&slot->data[0], &frame[0], len);
+                    slot->len = len;
+                    DYRxQueue_Commit(&s->queue);
+                }
+            } else {
+                sent = DYRxQueue_Push(&s->queue, &frame[0], len);
+            }
+            if (sent || s->lossy) {
+                break;
+            }
+            backoff(&spins);
+        }
+    }
+    __atomic_store_n(&s->done, true, __ATOMIC_RELEASE);
+    return NULL;
+}
+/*******************************************************************************
+  @func    : check
+  @param   : Stress_t *s, const DYRxFrame_t *frame, uint32_t *expect
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Verify one received frame against the next expected sequence.
+********************************************************************************/
+static void check(Stress_t *s, const DYRxFrame_t *frame, uint32_t *expect) {
+    uint8_t  ref[DY_RXQ_FRAME_SIZE];
+    uint32_t seq;
+
+    s->received++;
+    if ((frame->len < 8) || (frame->data[0] != 0xAA)) {
+        s->corrupt++;
+        return;
+    }
+    seq = (uint32_t)frame->data[3] | ((uint32_t)frame->data[4] << 8) |
+          ((uint32_t)frame->data[5] << 16) | ((uint32_t)frame->data[6] << 24);
+    if ((build(&ref[0], seq) != frame->len) || (memcmp(&ref[0], &frame->data[0], frame->len) != 0)) {
+        s->corrupt++;
+        return;
+    }
+    if ((seq < *expect) || (!s->lossy && (seq != *expect))) {
+        s->misordered++;
+    }
+    *expect = seq + 1;
+}
+/*******************************************************************************
+  @func    : run
+  @param   : bool lossy
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : One case, consumer on this thread. Prints the result, true if
+             every frame checked out.
+********************************************************************************/
+static bool run(bool lossy) {
+    static Stress_t s;
+    pthread_t       thread;
+    struct timespec t0, t1;
+    uint32_t        expect = 0;
+    uint32_t        n      = 0;
+    uint32_t        spins  = 0;
+
+    memset(&s, 0, sizeof(s));
+    DYRxQueue_Init(&s.queue);
+    s.lossy = lossy;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    pthread_create(&thread, NULL, producer, &s);
+    for (;;) {
+        bool done = __atomic_load_n(&s.done, __ATOMIC_ACQUIRE);
+
+        if ((n++ & 1U) == 0) {
+            const DYRxFrame_t *slot = DYRxQueue_Peek(&s.queue);
+
+            if (slot != NULL) {
+                check(&s, slot, &expect);
+                DYRxQueue_Release(&s.queue);
+                continue;
+            }
+        } else {
+            DYRxFrame_t frame;
+
+            if (DYRxQueue_Pop(&s.queue, &frame)) {
+                check(&s, &frame, &expect);
+                continue;
+            }
+        }
+        /* Empty after the producer finished: nothing is left on the way. */
+        if (done) {
+            break;
+        }
+        backoff(&spins);
+    }
+    pthread_join(thread, NULL);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    double   secs    = (double)(t1.tv_sec - t0.tv_sec) + (double)(t1.tv_nsec - t0.tv_nsec) / 1e9;
+    uint32_t dropped = s.queue.dropped;
+    bool     ok      = (s.corrupt == 0) && (s.misordered == 0) &&
+                       (lossy ? (s.received + dropped == STRESS_FRAMES) : (s.received == STRESS_FRAMES));
+
+    printf("  %-8s %9u received %9u %s  %u corrupt  %u out of order  %6.1f Mframes/s  %s\n",
+           lossy ? "lossy" : "lossless", (unsigned)s.received, (unsigned)dropped,
+           lossy ? "dropped" : "full   ", (unsigned)s.corrupt, (unsigned)s.misordered,
+           (double)s.received / secs / 1e6, ok ? "ok" : "FAILED");
+    return ok;
+}
+/*******************************************************************************
+  @func    : main
+  @param   : void
+  @return  : int
+  @date	   : 16.10.26
+  @brief   : Both cases, non-zero exit on any failure.
+********************************************************************************/
+int main(void) {
+    bool ok;
+
+    printf("%lu frames per case, queue of %u\n", STRESS_FRAMES, DY_RXQ_LEN);
+    ok  = run(false);
+    ok &= run(true);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,202 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYSeq_Bench.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Silence between back to back tracks on the simulator, from the
+  *          BUSY end edge of one track to the start edge of the next:
+  *          - a main loop polling checkPlayState() every BENCH_POLL_MS and
+  *            sending playSpecified() once the module stopped,
+  *          - DYSeq_t fired by the BUSY end edge, the edge seen after up to
+  *            BENCH_IRQ_US of interrupt latency and confirmed by a
+  *            DYBusy_Poll() from a timer `debounce` after it,
+  *          over blocking and queued (DMA) transmit. The module takes
+  *          startUs from a play command to audio, that part is in every gap.
+  *
+  *          gcc -std=c11 -O2 -IDYPlayer_Lib/inc -IDYPlayer_Lib/host $DY_SRC
+  *              DYPlayer_Lib/host/DYSim.c DYPlayer_Lib/host/DYPlayer_PortSim.c
+  *              DYPlayer_Lib/host/DYSeq_Bench.c -o dyseq_bench
+********************************************************************************/
+/************************************DEFINES***********************************/
+
+#define BENCH_TRACKS        12      /* Tracks of the sequence                  */
+#define BENCH_TRACK_US      800000  /* Length of every track                   */
+#define BENCH_IRQ_US        10      /* Latest the EXTI interrupt runs          */
+#define BENCH_TX_QUEUE      64      /* Transport buffer of the DMA case        */
+
+/************************************INCLUDES***********************************/
+#include <stdio.h>
+
+#include "DYPlayer.h"
+#include "DYPlayer_Busy.h"
+#include "DYPlayer_Seq.h"
+#include "DYPlayer_PortSim.h"
+
+static DYSim_t     sim;
+static DYPortSim_t port;
+static DYPlayer_t  player;
+static DYBusy_t    busy;
+static DYSeq_t     seq;
+
+static uint64_t    startAt[BENCH_TRACKS + 1];   /* BUSY edges, ns             */
+static uint64_t    endAt[BENCH_TRACKS + 1];
+static int         starts;
+static int         ends;
+
+static bool        edgePending;                 /* Edge not seen by the "IRQ" */
+static bool        edgeLevel;
+static uint64_t    edgeTime;
+static bool        confirmPending;              /* Timer after the last edge  */
+static uint64_t    confirmAt;
+
+
+/*******************************************************************************
+  @func    : onPin
+  @param   : void *ctx, bool level, uint64_t time
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : BUSY of the simulator changed, low while playing.
+********************************************************************************/
+static void onPin(void *ctx, bool level, uint64_t time) {
+    (void)ctx;
+    if (!level && (starts <= BENCH_TRACKS)) {
+        startAt[starts++] = time;
+    }
+    if (level && (ends <= BENCH_TRACKS)) {
+        endAt[ends++] = time;
+    }
+    edgePending = true;
+    edgeLevel   = level;
+    edgeTime    = time;
+}
+/*******************************************************************************
+  @func    : setup
+  @param   : uint16_t txQueue
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Fresh stopped module with tracks of BENCH_TRACK_US.
+********************************************************************************/
+static void setup(uint16_t txQueue) {
+    DYSimConfig_t config;
+
+    DYSim_DefaultConfig(&config);
+    config.trackUs = BENCH_TRACK_US;
+    DYSim_Init(&sim, &config);
+    DYSim_SetBusyCallback(&sim, onPin, NULL);
+    DYPortSim_Init(&port, &sim, txQueue);
+    DYPlayer_Init(&player, &DYTransport_Sim, &port);
+    starts      = 0;
+    ends        = 0;
+    edgePending    = false;
+    confirmPending = false;
+}
+/*******************************************************************************
+  @func    : report
+  @param   : const char *name, uint16_t txQueue
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Mean and worst silence between the tracks played.
+********************************************************************************/
+static void report(const char *name, uint16_t txQueue) {
+    uint64_t sum   = 0;
+    uint64_t worst = 0;
+    int      gaps  = 0;
+
+    for (int i = 0; (i + 1 < starts) && (i < ends); i++) {
+        uint64_t gap = startAt[i + 1] - endAt[i];
+
+        sum += gap;
+        if (gap > worst) worst = gap;
+        gaps++;
+    }
+    if (gaps != (BENCH_TRACKS - 1)) {
+        printf("  %s: %d of %d tracks played\n", name, gaps + 1, BENCH_TRACKS);
+    }
+    printf("  %-9s %-22s gap mean %7.2f ms  max %7.2f ms\n", (txQueue == 0) ? "blocking" : "queued",
+           name, (gaps > 0) ? (sum / (double)gaps) / 1e6 : 0.0, worst / 1e6);
+}
+/*******************************************************************************
+  @func    : polled
+  @param   : uint16_t txQueue, uint32_t pollMs
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Main loop asking for the play state every `pollMs`.
+********************************************************************************/
+static void polled(uint16_t txQueue, uint32_t pollMs) {
+    char name[32];
+
+    setup(txQueue);
+    DYPlayer.playSpecified(1);
+    for (uint16_t next = 2; next <= BENCH_TRACKS; ) {
+        if (DYPlayer.checkPlayState() == Stopped) {
+            DYPlayer.playSpecified(next++);
+        }
+        DYTransport_Sim.wait(&port, pollMs * 1000U);
+    }
+    DYPortSim_Run(&port, port.now + (BENCH_TRACK_US * 2000ULL));
+
+    snprintf(name, sizeof(name), "poll every %u ms", (unsigned)pollMs);
+    report(name, txQueue);
+}
+/*******************************************************************************
+  @func    : sequenced
+  @param   : uint16_t txQueue
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYSeq_t on the BUSY monitor, the edge handed over within
+             BENCH_IRQ_US as by the EXTI interrupt. A one shot timer polls
+             the pin `debounce` after the last edge to confirm its level.
+********************************************************************************/
+static void sequenced(uint16_t txQueue) {
+    setup(txQueue);
+    DYBusy_Init(&busy, true, DY_BUSY_DEBOUNCE_US, DYSim_BusyPin(&sim), (uint32_t)(port.now / 1000U));
+    DYSeq_Init(&seq, &player);
+    DYBusy_SetCallback(&busy, DYSeq_Busy, &seq);
+    for (uint16_t track = 1; track <= BENCH_TRACKS; track++) {
+        DYSeq_Add(&seq, track);
+    }
+
+    DYSeq_Start(&seq);
+    while (DYSeq_Running(&seq)) {
+        DYPortSim_Run(&port, port.now + (BENCH_IRQ_US * 1000ULL));
+        if (edgePending) {
+            edgePending    = false;
+            confirmPending = true;
+            confirmAt      = edgeTime + (DY_BUSY_DEBOUNCE_US * 1000ULL);
+            DYBusy_Edge(&busy, edgeLevel, (uint32_t)(edgeTime / 1000U));
+        }
+        if (confirmPending && (port.now >= confirmAt)) {
+            confirmPending = false;
+            DYBusy_Poll(&busy, DYSim_BusyPin(&sim), (uint32_t)(port.now / 1000U));
+        }
+    }
+    if ((seq.fired != (BENCH_TRACKS - 1)) || (seq.missed != 0)) {
+        printf("  fired %u, missed %u\n", (unsigned)seq.fired, (unsigned)seq.missed);
+    }
+    report("BUSY edge, DYSeq_t", txQueue);
+}
+/*******************************************************************************
+  @func    : main
+  @param   : void
+  @return  : int
+  @date	   : 16.10.26
+  @brief   : Every case over blocking and queued transmit.
+********************************************************************************/
+int main(void) {
+    static const uint32_t pollMs[] = { 0, 20, 100, 250 };
+    DYSimConfig_t         config;
+
+    DYSim_DefaultConfig(&config);
+    printf("%u tracks back to back, module start up %.1f ms\n", BENCH_TRACKS, config.startUs / 1e3);
+    for (int q = 0; q < 2; q++) {
+        uint16_t txQueue = (q == 0) ? 0 : BENCH_TX_QUEUE;
+
+        for (unsigned i = 0; i < sizeof(pollMs) / sizeof(pollMs[0]); i++) {
+            polled(txQueue, pollMs[i]);
+        }
+        sequenced(txQueue);
+    }
+    return 0;
+}
@@ -0,0 +1,746 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYSim.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 DY-HV20T module simulator.
+********************************************************************************/
+/************************************DEFINES***********************************/
+
+#define DYSIM_NEVER         UINT64_MAX
+#define DYSIM_FRAME_GAP     20000000ULL /* ns of silence that drops a partial frame */
+#define DYSIM_QUEUE_MASK    (DYSIM_QUEUE_SIZE - 1)
+
+/************************************INCLUDES***********************************/
+#include <string.h>
+
+#include "DYSim.h"
+
+
+/*******************************************************************************
+  @func    : lineCount
+  @param   : const DYSimLine_t *line
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Bytes queued on a line.
+********************************************************************************/
+static uint16_t lineCount(const DYSimLine_t *line) {
+    return (uint16_t)(line->head - line->tail);
+}
+/*******************************************************************************
+  @func    : linePush
+  @param   : DYSimLine_t *line, uint8_t byte, uint64_t ready, uint64_t byteNs
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Put a byte on the line. It starts once the line is idle and not
+             before `ready`, and is complete one byte time later.
+********************************************************************************/
+static bool linePush(DYSimLine_t *line, uint8_t byte, uint64_t ready, uint64_t byteNs) {
+    if (lineCount(line) >= DYSIM_QUEUE_SIZE) {
+        return false;
+    }
+
+    uint64_t start = (ready > line->lineFree) ? ready : line->lineFree;
+    DYSimByte_t *entry = &line->entry[line->head & DYSIM_QUEUE_MASK];
+
+    entry->byte    = byte;
+    entry->time    = start + byteNs;
+    line->lineFree = entry->time;
+    line->head++;
+    return true;
+}
+/*******************************************************************************
+  @func    : lineNext
+  @param   : const DYSimLine_t *line
+  @return  : uint64_t
+  @date	   : 16.10.26
+  @brief   : Completion time of the oldest queued byte.
+********************************************************************************/
+static uint64_t lineNext(const DYSimLine_t *line) {
+    if (lineCount(line) == 0) {
+        return DYSIM_NEVER;
+    }
+    return line->entry[line->tail & DYSIM_QUEUE_MASK].time;
+}
+/*******************************************************************************
+  @func    : trackNs
+  @param   : const DYSim_t *sim, uint16_t track
+  @return  : uint64_t
+  @date	   : 16.10.26
+  @brief   : Play time of a track.
+********************************************************************************/
+static uint64_t trackNs(const DYSim_t *sim, uint16_t track) {
+    if ((sim->config.trackLengths != NULL) && (track >= 1) && (track <= sim->config.trackCount)) {
+        return (uint64_t)sim->config.trackLengths[track - 1] * 1000U;
+    }
+    return (uint64_t)sim->config.trackUs * 1000U;
+}
+/*******************************************************************************
+  @func    : folderFirst
+  @param   : const DYSim_t *sim, uint16_t track
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : First track of the folder a track is in.
+********************************************************************************/
+static uint16_t folderFirst(const DYSim_t *sim, uint16_t track) {
+    return (uint16_t)(((track - 1) / sim->config.folderSize) * sim->config.folderSize + 1);
+}
+/*******************************************************************************
+  @func    : folderLast
+  @param   : const DYSim_t *sim, uint16_t track
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Last track of the folder a track is in.
+********************************************************************************/
+static uint16_t folderLast(const DYSim_t *sim, uint16_t track) {
+    uint16_t last = folderFirst(sim, track) + sim->config.folderSize - 1;
+    return (last > sim->config.trackCount) ? sim->config.trackCount : last;
+}
+/*******************************************************************************
+  @func    : randomTrack
+  @param   : DYSim_t *sim, uint16_t first, uint16_t last
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Repeatable pseudo random track in [first, last] (xorshift32).
+********************************************************************************/
+static uint16_t randomTrack(DYSim_t *sim, uint16_t first, uint16_t last) {
+    sim->random ^= sim->random << 13;
+    sim->random ^= sim->random >> 17;
+    sim->random ^= sim->random << 5;
+    return (uint16_t)(first + sim->random % (uint32_t)(last - first + 1));
+}
+/*******************************************************************************
+  @func    : setBusy
+  @param   : DYSim_t *sim, bool busy, uint64_t time
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Drive the BUSY line, reports every change.
+********************************************************************************/
+static void setBusy(DYSim_t *sim, bool busy, uint64_t time) {
+    if (sim->busy == busy) {
+        return;
+    }
+    sim->busy = busy;
+    if (sim->onBusy != NULL) {
+        sim->onBusy(sim->onBusyCtx, !busy, time);
+    }
+}
+/*******************************************************************************
+  @func    : startTrack
+  @param   : DYSim_t *sim, uint16_t track, uint64_t time
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Play a track from the start. Audio, and BUSY, follow after the
+             module start up time.
+********************************************************************************/
+static void startTrack(DYSim_t *sim, uint16_t track, uint64_t time) {
+    setBusy(sim, false, time);
+    sim->track     = track;
+    sim->state     = DYSIM_PLAYING;
+    sim->remaining = trackNs(sim, track);
+    sim->startAt   = time + (uint64_t)sim->config.startUs * 1000U;
+}
+/*******************************************************************************
+  @func    : holdAudio
+  @param   : DYSim_t *sim, DYSimState_t state, uint64_t time
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Leave the playing state, keeps the play position for resuming.
+********************************************************************************/
+static void holdAudio(DYSim_t *sim, DYSimState_t state, uint64_t time) {
+    if ((sim->state == DYSIM_PLAYING) && (time > sim->startAt)) {
+        uint64_t played = time - sim->startAt;
+        sim->remaining = (played < sim->remaining) ? (sim->remaining - played) : 0;
+    }
+    sim->state = state;
+    setBusy(sim, false, time);
+}
+/*******************************************************************************
+  @func    : stopAll
+  @param   : DYSim_t *sim, uint64_t time
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Stop playing, also ends an interlude and a combination list.
+********************************************************************************/
+static void stopAll(DYSim_t *sim, uint64_t time) {
+    holdAudio(sim, DYSIM_STOPPED, time);
+    sim->interlude      = false;
+    sim->combinationLen = 0;
+}
+/*******************************************************************************
+  @func    : endInterlude
+  @param   : DYSim_t *sim, uint64_t time
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Return to where the interlude broke in.
+********************************************************************************/
+static void endInterlude(DYSim_t *sim, uint64_t time) {
+    setBusy(sim, false, time);
+    sim->interlude = false;
+    sim->track     = sim->resumeTrack;
+    sim->remaining = sim->resumeRemaining;
+    sim->state     = sim->resumeState;
+    if (sim->state == DYSIM_PLAYING) {
+        sim->startAt = time + (uint64_t)sim->config.startUs * 1000U;
+    }
+}
+/*******************************************************************************
+  @func    : startInterlude
+  @param   : DYSim_t *sim, uint16_t track, uint64_t time
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Play a track over the current one. Only one level: a second
+             interlude replaces the first but still returns to the music.
+********************************************************************************/
+static void startInterlude(DYSim_t *sim, uint16_t track, uint64_t time) {
+    if ((track < 1) || (track > sim->config.trackCount)) {
+        return;
+    }
+    if (!sim->interlude) {
+        DYSimState_t state = sim->state;
+        holdAudio(sim, DYSIM_PAUSED, time);
+        sim->resumeTrack     = sim->track;
+        sim->resumeRemaining = sim->remaining;
+        sim->resumeState     = state;
+        sim->interlude       = true;
+    }
+    startTrack(sim, track, time);
+}
+/*******************************************************************************
+  @func    : trackEnded
+  @param   : DYSim_t *sim, uint64_t time
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : A track played out: interlude, combination list, then loop mode
+             decide what comes next.
+********************************************************************************/
+static void trackEnded(DYSim_t *sim, uint64_t time) {
+    uint16_t count = sim->config.trackCount;
+    uint16_t track = sim->track;
+    uint16_t next  = 0;
+    bool     cycle = false;
+
+    setBusy(sim, false, time);
+    sim->remaining = 0;
+
+    if (sim->interlude) {
+        endInterlude(sim, time);
+        return;
+    }
+
+    if (sim->combinationLen > 0) {
+        if (sim->combinationPos < sim->combinationLen) {
+            startTrack(sim, sim->combination[sim->combinationPos++], time);
+        } else {
+            sim->combinationLen = 0;
+            sim->state          = DYSIM_STOPPED;
+        }
+        return;
+    }
+
+    switch (sim->loopMode) {
+        case 0:     /* Repeat */
+            next  = (track % count) + 1;
+            cycle = (next == 1);
+            break;
+        case 1:     /* RepeatOne */
+            next  = track;
+            cycle = true;
+            break;
+        case 3:     /* Random */
+            next = randomTrack(sim, 1, count);
+            break;
+        case 4:     /* RepeatDir */
+            next  = (track < folderLast(sim, track)) ? track + 1 : folderFirst(sim, track);
+            cycle = (next == folderFirst(sim, track));
+            break;
+        case 5:     /* RandomDir */
+            next = randomTrack(sim, folderFirst(sim, track), folderLast(sim, track));
+            break;
+        case 6:     /* SequenceDir */
+            next = (track < folderLast(sim, track)) ? track + 1 : 0;
+            break;
+        case 7:     /* Sequence */
+            next = (track < count) ? track + 1 : 0;
+            break;
+        default:    /* OneOff */
+            break;
+    }
+
+    if (cycle && (sim->cycles != 0) && (++sim->cyclesDone >= sim->cycles)) {
+        next = 0;
+    }
+
+    if (next == 0) {
+        sim->state = DYSIM_STOPPED;
+        return;
+    }
+    startTrack(sim, next, time);
+}
+/*******************************************************************************
+  @func    : respond
+  @param   : DYSim_t *sim, uint64_t time, uint8_t opcode, uint16_t value, uint8_t len
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Queue an answer frame with 1 or 2 data bytes, high byte first.
+********************************************************************************/
+static void respond(DYSim_t *sim, uint64_t time, uint8_t opcode, uint16_t value, uint8_t len) {
+    uint8_t  frame[6];
+    uint8_t  n     = 0;
+    uint8_t  sum   = 0;
+    uint64_t ready = time + (uint64_t)sim->config.responseUs * 1000U;
+
+    frame[n++] = 0xAA;
+    frame[n++] = opcode;
+    frame[n++] = len;
+    if (len == 2) {
+        frame[n++] = (uint8_t)(value >> 8);
+    }
+    frame[n++] = (uint8_t)value;
+    for (uint8_t i = 0; i < n; i++) {
+        sum += frame[i];
+    }
+    frame[n++] = sum;
+
+    for (uint8_t i = 0; i < n; i++) {
+        if (!linePush(&sim->out, frame[i], ready, sim->byteNs)) {
+            sim->dropped++;
+        }
+    }
+}
+/*******************************************************************************
+  @func    : pathTrack
+  @param   : DYSim_t *sim, const uint8_t *data, uint8_t len
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Keep the received path and find the track it names, i.e. the number
+             of the last path element ("00005*MP3" is track 5). 0 if
+             it does not name one.
+********************************************************************************/
+static uint16_t pathTrack(DYSim_t *sim, const uint8_t *data, uint8_t len) {
+    uint8_t  start  = 0;
+    uint32_t number = 0;
+
+    if (len >= sizeof(sim->path)) {
+        len = sizeof(sim->path) - 1;
+    }
+    memcpy(sim->path, data, len);
+    sim->path[len] = '\0';
+
+    for (uint8_t i = 0; i < len; i++) {
+        if (data[i] == '/') {
+            start = i + 1;
+        }
+    }
+    for (uint8_t i = start; (i < len) && (data[i] != '*'); i++) {
+        if ((data[i] < '0') || (data[i] > '9')) {
+            return 0;
+        }
+        number = number * 10 + (data[i] - '0');
+    }
+    return ((number >= 1) && (number <= sim->config.trackCount)) ? (uint16_t)number : 0;
+}
+/*******************************************************************************
+  @func    : execute
+  @param   : DYSim_t *sim, uint64_t time
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Run the complete, checksum valid frame in `sim->frame`.
+********************************************************************************/
+static void execute(DYSim_t *sim, uint64_t time) {
+    uint8_t        opcode = sim->frame[1];
+    uint8_t        len    = sim->frame[2];
+    const uint8_t *data   = &sim->frame[3];
+    uint16_t       word   = (len >= 2) ? (uint16_t)((data[len - 2] << 8) | data[len - 1]) : 0;
+    uint16_t       count  = sim->config.trackCount;
+    uint16_t       track  = sim->track;
+    bool           ok     = true;
+
+    switch (opcode) {
+        case 0x01:
+            respond(sim, time, opcode, (uint16_t)sim->state, 1);
+            break;
+        case 0x02:
+            if (sim->state == DYSIM_PAUSED) {
+                sim->state   = DYSIM_PLAYING;
+                sim->startAt = time + (uint64_t)sim->config.startUs * 1000U;
+            } else if (sim->state == DYSIM_STOPPED) {
+                startTrack(sim, track, time);
+            }
+            break;
+        case 0x03:
+            if (sim->state == DYSIM_PLAYING) {
+                holdAudio(sim, DYSIM_PAUSED, time);
+            }
+            break;
+        case 0x04:
+            stopAll(sim, time);
+            break;
+        case 0x05:
+            startTrack(sim, (track > 1) ? track - 1 : count, time);
+            break;
+        case 0x06:
+            startTrack(sim, (track % count) + 1, time);
+            break;
+        case 0x07:
+            ok = (len == 2);
+            if (ok && (word >= 1) && (word <= count)) {
+                startTrack(sim, word, time);
+            }
+            break;
+        case 0x08:
+            ok = (len >= 2);
+            if (ok) {
+                uint16_t found = pathTrack(sim, &data[1], len - 1);
+                if (found != 0) {
+                    sim->device = data[0];
+                    startTrack(sim, found, time);
+                }
+            }
+            break;
+        case 0x09:
+            respond(sim, time, opcode, sim->config.devices, 1);
+            break;
+        case 0x0A:
+            respond(sim, time, opcode, sim->device, 1);
+            break;
+        case 0x0B:
+            ok = (len == 1);
+            if (ok && (data[0] < 8) && (sim->config.devices & (1U << data[0]))) {
+                stopAll(sim, time);
+                sim->device = data[0];
+                sim->track  = 1;
+            }
+            break;
+        case 0x0C:
+            respond(sim, time, opcode, count, 2);
+            break;
+        case 0x0D:
+            respond(sim, time, opcode, track, 2);
+            break;
+        case 0x0E: {
+            uint16_t first = folderFirst(sim, track);
+            startTrack(sim, (first > 1) ? folderFirst(sim, first - 1) : folderFirst(sim, count), time);
+            break;
+        }
+        case 0x0F: {
+            uint16_t last = folderLast(sim, track);
+            startTrack(sim, (last < count) ? last + 1 : 1, time);
+            break;
+        }
+        case 0x10:
+            if (sim->interlude) {
+                endInterlude(sim, time);
+            } else {
+                stopAll(sim, time);
+            }
+            break;
+        case 0x11:
+            respond(sim, time, opcode, folderFirst(sim, track), 2);
+            break;
+        case 0x12:
+            respond(sim, time, opcode, folderLast(sim, track) - folderFirst(sim, track) + 1, 2);
+            break;
+        case 0x13:
+            ok = (len == 1);
+            if (ok) {
+                sim->volume = (data[0] > DYSIM_VOLUME_MAX) ? DYSIM_VOLUME_MAX : data[0];
+            }
+            break;
+        case 0x14:
+            if (sim->volume < DYSIM_VOLUME_MAX) sim->volume++;
+            break;
+        case 0x15:
+            if (sim->volume > 0) sim->volume--;
+            break;
+        case 0x16:
+            ok = (len == 3);
+            if (ok) {
+                startInterlude(sim, word, time);
+            }
+            break;
+        case 0x17:
+            ok = (len >= 2);
+            if (ok) {
+                startInterlude(sim, pathTrack(sim, &data[1], len - 1), time);
+            }
+            break;
+        case 0x18:
+            ok = (len == 1) && (data[0] <= 7);
+            if (ok) {
+                sim->loopMode   = data[0];
+                sim->cyclesDone = 0;
+            }
+            break;
+        case 0x19:
+            ok = (len == 2);
+            if (ok) {
+                sim->cycles     = word;
+                sim->cyclesDone = 0;
+            }
+            break;
+        case 0x1A:
+            ok = (len == 1) && (data[0] <= 4);
+            if (ok) {
+                sim->eq = data[0];
+            }
+            break;
+        case 0x1B:
+            ok = (len >= 2) && ((len % 2) == 0) && ((len / 2) <= DYSIM_COMBINATION);
+            if (ok) {
+                sim->combinationLen = 0;
+                for (uint8_t i = 0; i < len; i += 2) {
+                    uint8_t number = (uint8_t)((data[i] - '0') * 10 + (data[i + 1] - '0'));
+                    if ((number >= 1) && (number <= count)) {
+                        sim->combination[sim->combinationLen++] = number;
+                    }
+                }
+                if (sim->combinationLen > 0) {
+                    sim->interlude      = false;
+                    sim->combinationPos = 1;
+                    startTrack(sim, sim->combination[0], time);
+                }
+            }
+            break;
+        case 0x1C:
+            if (sim->combinationLen > 0) {
+                stopAll(sim, time);
+            }
+            break;
+        case 0x1F:
+            ok = (len == 2);
+            if (ok && (word >= 1) && (word <= count)) {
+                stopAll(sim, time);
+                sim->track = word;
+            }
+            break;
+        default:
+            ok = false;
+            break;
+    }
+
+    if (!ok) {
+        sim->unknown++;
+        return;
+    }
+    sim->frames++;
+    sim->opcodeCount[opcode & 0x1F]++;
+}
+/*******************************************************************************
+  @func    : receive
+  @param   : DYSim_t *sim, uint8_t byte, uint64_t time
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Frame a byte that just arrived. Anything before a 0xAA header is
+             skipped, a pause longer than DYSIM_FRAME_GAP drops a partial frame.
+********************************************************************************/
+static void receive(DYSim_t *sim, uint8_t byte, uint64_t time) {
+    uint64_t previous = sim->lastIn;
+
+    sim->bytesIn++;
+    sim->lastIn = time;
+
+    if ((sim->frameLen > 0) && ((time - previous) > DYSIM_FRAME_GAP)) {
+        sim->frameLen = 0;
+    }
+    if ((sim->frameLen == 0) && (byte != 0xAA)) {
+        return;
+    }
+
+    sim->frame[sim->frameLen++] = byte;
+    if (sim->frameLen < 3) {
+        return;
+    }
+    if (sim->frame[2] > (DYSIM_FRAME_MAX - 4)) {
+        sim->frameLen = 0;
+        return;
+    }
+    if (sim->frameLen < (sim->frame[2] + 4)) {
+        return;
+    }
+
+    uint8_t sum = 0;
+    for (uint8_t i = 0; i < (sim->frameLen - 1); i++) {
+        sum += sim->frame[i];
+    }
+    if (sum == sim->frame[sim->frameLen - 1]) {
+        execute(sim, time);
+    } else {
+        sim->crcErrors++;
+    }
+    sim->frameLen = 0;
+}
+/*******************************************************************************
+  @func    : audioEvent
+  @param   : const DYSim_t *sim
+  @return  : uint64_t
+  @date	   : 16.10.26
+  @brief   : Next BUSY change caused by the audio itself.
+********************************************************************************/
+static uint64_t audioEvent(const DYSim_t *sim) {
+    if (sim->state != DYSIM_PLAYING) {
+        return DYSIM_NEVER;
+    }
+    return sim->busy ? (sim->startAt + sim->remaining) : sim->startAt;
+}
+/*******************************************************************************
+  @func    : DYSim_DefaultConfig
+  @param   : DYSimConfig_t *config
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : 9600 baud module, SD card with 100 tracks of 3 s in folders of
+             10. Response and start up times are typical bench figures of a
+             DY-HV20T, adjust them to the module at hand.
+********************************************************************************/
+void DYSim_DefaultConfig(DYSimConfig_t *config) {
+    memset(config, 0, sizeof(*config));
+    config->baud       = 9600;
+    config->devices    = 0x02;
+    config->device     = 0x01;
+    config->trackCount = 100;
+    config->folderSize = 10;
+    config->trackUs    = 3000000;
+    config->responseUs = 2000;
+    config->startUs    = 30000;
+    config->volume     = 20;
+}
+/*******************************************************************************
+  @func    : DYSim_Init
+  @param   : DYSim_t *sim, const DYSimConfig_t *config
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Power up a module at time 0.
+********************************************************************************/
+void DYSim_Init(DYSim_t *sim, const DYSimConfig_t *config) {
+    memset(sim, 0, sizeof(*sim));
+    sim->config = *config;
+    if (sim->config.folderSize == 0) {
+        sim->config.folderSize = 1;
+    }
+    sim->byteNs   = 10000000000ULL / config->baud;
+    sim->device   = config->device;
+    sim->volume   = config->volume;
+    sim->track    = 1;
+    sim->loopMode = 2;
+    sim->random   = 0x2545F491;
+}
+/*******************************************************************************
+  @func    : DYSim_SetBusyCallback
+  @param   : DYSim_t *sim, void (*cb)(void *, bool, uint64_t), void *ctx
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Report BUSY pin changes with the simulated time they happen at.
+********************************************************************************/
+void DYSim_SetBusyCallback(DYSim_t *sim, void (*cb)(void *, bool, uint64_t), void *ctx) {
+    sim->onBusy    = cb;
+    sim->onBusyCtx = ctx;
+}
+/*******************************************************************************
+  @func    : DYSim_Advance
+  @param   : DYSim_t *sim, uint64_t now
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Run everything due up to `now`: bytes that finished arriving and
+             the audio, in time order.
+********************************************************************************/
+void DYSim_Advance(DYSim_t *sim, uint64_t now) {
+    for (;;) {
+        uint64_t tIn    = lineNext(&sim->in);
+        uint64_t tAudio = audioEvent(sim);
+
+        if ((tIn > now) && (tAudio > now)) {
+            break;
+        }
+        if (tAudio <= tIn) {
+            if (!sim->busy) {
+                setBusy(sim, true, tAudio);
+            } else {
+                trackEnded(sim, tAudio);
+            }
+        } else {
+            DYSimByte_t *entry = &sim->in.entry[sim->in.tail & DYSIM_QUEUE_MASK];
+            sim->in.tail++;
+            receive(sim, entry->byte, entry->time);
+        }
+    }
+    if (now > sim->now) {
+        sim->now = now;
+    }
+}
+/*******************************************************************************
+  @func    : DYSim_Write
+  @param   : DYSim_t *sim, uint64_t now, const uint8_t *data, uint16_t len
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Host starts sending bytes at `now`. They reach the module one
+             byte time apart, after what is still on the line. Returns the
+             amount taken, less than `len` when the line queue is full.
+********************************************************************************/
+uint16_t DYSim_Write(DYSim_t *sim, uint64_t now, const uint8_t *data, uint16_t len) {
+    uint16_t n;
+
+    DYSim_Advance(sim, now);
+    for (n = 0; n < len; n++) {
+        if (!linePush(&sim->in, data[n], now, sim->byteNs)) {
+            break;
+        }
+    }
+    return n;
+}
+/*******************************************************************************
+  @func    : DYSim_Read
+  @param   : DYSim_t *sim, uint64_t now, uint8_t *buffer, uint16_t len
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Bytes the module has completely sent by `now`.
+********************************************************************************/
+uint16_t DYSim_Read(DYSim_t *sim, uint64_t now, uint8_t *buffer, uint16_t len) {
+    uint16_t n = 0;
+
+    DYSim_Advance(sim, now);
+    while ((n < len) && (lineNext(&sim->out) <= now)) {
+        buffer[n++] = sim->out.entry[sim->out.tail & DYSIM_QUEUE_MASK].byte;
+        sim->out.tail++;
+        sim->bytesOut++;
+    }
+    return n;
+}
+/*******************************************************************************
+  @func    : DYSim_NextEvent
+  @param   : const DYSim_t *sim
+  @return  : uint64_t
+  @date	   : 16.10.26
+  @brief   : Time of the next thing that happens on its own: a byte completing
+             on either line or a BUSY change. UINT64_MAX if nothing is pending.
+********************************************************************************/
+uint64_t DYSim_NextEvent(const DYSim_t *sim) {
+    uint64_t next = lineNext(&sim->in);
+    uint64_t out  = lineNext(&sim->out);
+    uint64_t aud  = audioEvent(sim);
+
+    if (out < next) next = out;
+    if (aud < next) next = aud;
+    return next;
+}
+/*******************************************************************************
+  @func    : DYSim_InputPending
+  @param   : const DYSim_t *sim
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Host bytes not yet completely on the wire.
+********************************************************************************/
+uint16_t DYSim_InputPending(const DYSim_t *sim) {
+    return lineCount(&sim->in);
+}
+/*******************************************************************************
+  @func    : DYSim_BusyPin
+  @param   : const DYSim_t *sim
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : BUSY pin level, low while audio is playing.
+********************************************************************************/
+bool DYSim_BusyPin(const DYSim_t *sim) {
+    return !sim->busy;
+}
@@ -0,0 +1,147 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYSim.h
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 DY-HV20T module simulator. Decodes command frames, keeps the play
+  *          state, volume, EQ, loop mode, interlude / combination play and the
+  *          BUSY line, and answers queries with checksummed frames. Both UART
+  *          directions are timed at the configured baud rate.
+  *
+  *          Time is given by the caller in nanoseconds, so the same core runs
+  *          on a virtual clock (DYPlayer_PortSim) or on real time (DYSim_Pty).
+********************************************************************************/
+#ifndef DYSIM_H
+#define DYSIM_H
+
+/************************************DEFINES***********************************/
+
+#define DYSIM_QUEUE_SIZE    256     /* Bytes on each UART direction            */
+#define DYSIM_FRAME_MAX     64      /* Longest frame the module accepts        */
+#define DYSIM_COMBINATION   30      /* Entries of a combination play list      */
+#define DYSIM_VOLUME_MAX    30
+
+/************************************INCLUDES***********************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Module play state, same values as the 0x01 query answer.
+ */
+typedef enum
+{
+    DYSIM_STOPPED = 0,
+    DYSIM_PLAYING = 1,
+    DYSIM_PAUSED  = 2
+} DYSimState_t;
+
+/**
+ * Module content and timing. DYSim_DefaultConfig() fills in a 9600 baud
+ * module with an SD card of 100 three second tracks in folders of 10.
+ */
+typedef struct
+{
+    uint32_t        baud;           /* UART rate, 10 bits per byte (8N1)        */
+    uint8_t         devices;        /* Online mask: bit0 USB, bit1 SD, bit2 Flash */
+    uint8_t         device;         /* Play device after power up               */
+    uint16_t        trackCount;     /* Tracks on the play device, 1 based       */
+    uint16_t        folderSize;     /* Tracks per folder for 0x0E/0x0F/0x11/0x12 */
+    uint32_t        trackUs;        /* Length of every track...                 */
+    const uint32_t *trackLengths;   /* ...unless given per track, [0] = track 1 */
+    uint32_t        responseUs;     /* Frame received to first answer byte      */
+    uint32_t        startUs;        /* Play command to audio, BUSY going active */
+    uint8_t         volume;         /* Power up volume                          */
+} DYSimConfig_t;
+
+/**
+ * Time stamped byte on one of the UART lines.
+ */
+typedef struct
+{
+    uint64_t time;                  /* Last stop bit on the line, ns            */
+    uint8_t  byte;
+} DYSimByte_t;
+
+/**
+ * Byte queue of one UART direction.
+ */
+typedef struct
+{
+    DYSimByte_t entry[DYSIM_QUEUE_SIZE];
+    uint16_t    head;
+    uint16_t    tail;
+    uint64_t    lineFree;           /* Line idle from here on, ns               */
+} DYSimLine_t;
+
+/**
+ * Simulated module.
+ */
+typedef struct
+{
+    DYSimConfig_t config;
+    uint64_t      byteNs;           /* Wire time of one byte                    */
+    uint64_t      now;              /* Time the state was last advanced to      */
+
+    DYSimLine_t   in;               /* Host -> module                           */
+    DYSimLine_t   out;              /* Module -> host                           */
+
+    uint8_t       frame[DYSIM_FRAME_MAX];
+    uint8_t       frameLen;
+    uint64_t      lastIn;           /* Arrival of the previous host byte        */
+
+    DYSimState_t  state;
+    uint8_t       device;
+    uint16_t      track;            /* Current / selected track                 */
+    uint64_t      startAt;          /* Audio (re)starts here while playing      */
+    uint64_t      remaining;        /* Audio left at `startAt`                  */
+    bool          busy;             /* Audio coming out, BUSY pin driven low    */
+
+    uint8_t       volume;
+    uint8_t       eq;
+    uint8_t       loopMode;
+    uint16_t      cycles;           /* Loop count for modes 0, 1, 4, 0 endless  */
+    uint16_t      cyclesDone;
+
+    bool          interlude;        /* Interlude playing over `resume*`         */
+    uint16_t      resumeTrack;
+    uint64_t      resumeRemaining;
+    DYSimState_t  resumeState;
+
+    uint8_t       combination[DYSIM_COMBINATION];
+    uint8_t       combinationLen;
+    uint8_t       combinationPos;   /* Next entry, valid while combinationLen > 0 */
+
+    char          path[DYSIM_FRAME_MAX]; /* Last path received, as on the wire  */
+    uint32_t      random;
+
+    /* BUSY pin change, `level` is the pin (low while playing). */
+    void        (*onBusy)(void *ctx, bool level, uint64_t time);
+    void         *onBusyCtx;
+
+    /* Counters */
+    uint32_t      frames;           /* Valid frames executed                    */
+    uint32_t      opcodeCount[0x20];/* Valid frames per opcode                  */
+    uint32_t      crcErrors;
+    uint32_t      unknown;          /* Valid checksum, opcode not supported     */
+    uint32_t      dropped;          /* Bytes lost to a full queue               */
+    uint32_t      bytesIn;
+    uint32_t      bytesOut;
+} DYSim_t;
+
+/**
+ * Function Declerations
+ */
+void          DYSim_DefaultConfig(DYSimConfig_t *config);
+void          DYSim_Init(DYSim_t *sim, const DYSimConfig_t *config);
+void          DYSim_SetBusyCallback(DYSim_t *sim, void (*cb)(void *, bool, uint64_t), void *ctx);
+uint16_t      DYSim_Write(DYSim_t *sim, uint64_t now, const uint8_t *data, uint16_t len);
+uint16_t      DYSim_Read(DYSim_t *sim, uint64_t now, uint8_t *buffer, uint16_t len);
+void          DYSim_Advance(DYSim_t *sim, uint64_t now);
+uint64_t      DYSim_NextEvent(const DYSim_t *sim);
+uint16_t      DYSim_InputPending(const DYSim_t *sim);
+bool          DYSim_BusyPin(const DYSim_t *sim);
+
+#endif /* DYSIM_H */
@@ -0,0 +1,167 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYSim_Pty.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Runs a DYSim module on a pseudo-terminal in real time, so any
+  *          program that opens a serial port (DYPlayer_HostExample, a terminal,
+  *          a script) can talk to it. The slave device name is printed on
+  *          start up, Ctrl+C prints the module counters and exits.
+  *
+  *          gcc -std=c11 -O2 -IDYPlayer_Lib/host DYPlayer_Lib/host/DYSim.c
+  *              DYPlayer_Lib/host/DYSim_Pty.c -o dysim_pty
+  *
+  *          ./dysim_pty [-v]          -v: print every BUSY change
+********************************************************************************/
+/************************************DEFINES***********************************/
+
+#define _XOPEN_SOURCE 600
+#define _DEFAULT_SOURCE             /* cfmakeraw(), ppoll()                    */
+#define _GNU_SOURCE
+
+/************************************INCLUDES***********************************/
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "DYSim.h"
+
+
+static volatile sig_atomic_t running = 1;
+static uint64_t              origin;
+
+/*******************************************************************************
+  @func    : nowNs
+  @param   : void
+  @return  : uint64_t
+  @date	   : 16.10.26
+  @brief   : Nanoseconds since start up, the module time base.
+********************************************************************************/
+static uint64_t nowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec - origin;
+}
+/*******************************************************************************
+  @func    : onSignal
+  @param   : int sig
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Leave the main loop.
+********************************************************************************/
+static void onSignal(int sig) {
+    (void)sig;
+    running = 0;
+}
+/*******************************************************************************
+  @func    : onBusy
+  @param   : void *ctx, bool level, uint64_t time
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Print BUSY changes in verbose mode.
+********************************************************************************/
+static void onBusy(void *ctx, bool level, uint64_t time) {
+    DYSim_t *sim = (DYSim_t *)ctx;
+    fprintf(stderr, "%10.3f ms  BUSY %s  track %u\n",
+            time / 1e6, level ? "high" : "low ", (unsigned)sim->track);
+}
+/*******************************************************************************
+  @func    : main
+  @param   : int argc, char *argv[]
+  @return  : int
+  @date	   : 16.10.26
+  @brief   : Bytes written to the slave reach the module at 9600 baud pace,
+             answers are written back when their last stop bit would be on
+             the wire.
+********************************************************************************/
+int main(int argc, char *argv[]) {
+    static DYSim_t sim;
+    DYSimConfig_t  config;
+    struct termios tio;
+    uint8_t        buffer[64];
+
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if ((master < 0) || (grantpt(master) != 0) || (unlockpt(master) != 0)) {
+        perror("pty");
+        return 1;
+    }
+    if (tcgetattr(master, &tio) == 0) {
+        cfmakeraw(&tio);
+        tcsetattr(master, TCSANOW, &tio);
+    }
+    fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK);
+
+    /* Keep the master readable while no one has the slave open. */
+    int keep = open(ptsname(master), O_RDWR | O_NOCTTY);
+
+    DYSim_DefaultConfig(&config);
+    DYSim_Init(&sim, &config);
+    if ((argc > 1) && (strcmp(argv[1], "-v") == 0)) {
+        DYSim_SetBusyCallback(&sim, onBusy, &sim);
+    }
+
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    origin = (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+
+    printf("%s\n", ptsname(master));
+    fflush(stdout);
+
+    while (running) {
+        uint64_t        now  = nowNs();
+        uint64_t        next = DYSim_NextEvent(&sim);
+        uint64_t        wait = (next > now) ? (next - now) : 0;
+        struct pollfd   pfd  = { master, POLLIN, 0 };
+        struct timespec tmo;
+
+        /* Wake up at least every 100 ms to notice signals. */
+        if (wait > 100000000ULL) {
+            wait = 100000000ULL;
+        }
+        tmo.tv_sec  = (time_t)(wait / 1000000000ULL);
+        tmo.tv_nsec = (long)(wait % 1000000000ULL);
+        if ((ppoll(&pfd, 1, &tmo, NULL) < 0) && (errno != EINTR)) {
+            break;
+        }
+
+        now = nowNs();
+        if (pfd.revents & POLLIN) {
+            ssize_t n = read(master, buffer, sizeof(buffer));
+            if (n > 0) {
+                uint16_t taken = DYSim_Write(&sim, now, buffer, (uint16_t)n);
+                sim.dropped += (uint32_t)n - taken;
+            }
+        }
+
+        uint16_t n = DYSim_Read(&sim, now, buffer, sizeof(buffer));
+        if (n > 0) {
+            if (write(master, buffer, n) < 0) {
+                sim.dropped += n;
+            }
+        }
+    }
+
+    fprintf(stderr, "frames %u  crc errors %u  unknown %u  dropped %u  in %u  out %u\n",
+            sim.frames, sim.crcErrors, sim.unknown, sim.dropped, sim.bytesIn, sim.bytesOut);
+    fprintf(stderr, "state %d  track %u  volume %u  eq %u  loop %u  path \"%s\"\n",
+            (int)sim.state, (unsigned)sim.track, (unsigned)sim.volume, (unsigned)sim.eq,
+            (unsigned)sim.loopMode, sim.path);
+
+    if (keep >= 0) {
+        close(keep);
+    }
+    close(master);
+    return 0;
+}
@@ -0,0 +1,309 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYTrace_Decode.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Turns a DYTrace_Dump() capture into a timeline: every TX and RX
+  *          record with its time, bytes and command, and for each answer the
+  *          round trip time from its query. A summary per opcode follows.
+  *
+  *          The capture is the raw dump, e.g. the ITM port 0 payload as the
+  *          debugger saves it or the bytes of the debug UART. Anything before
+  *          the "DYTR" header is skipped.
+  *
+  *          An answer belongs to the oldest query of its opcode sent at most
+  *          DECODE_TIMEOUT_MS before it; older unanswered ones count as lost.
+  *
+  *          gcc -std=c11 -O2 -DDY_PARSER_MAX_DATA=60 -IDYPlayer_Lib/inc
+  *              DYPlayer_Lib/src/DYPlayer_Parser.c DYPlayer_Lib/src/DYPlayer_Frame.c
+  *              DYPlayer_Lib/host/DYTrace_Decode.c -o dytrace_decode
+  *          dytrace_decode capture.bin
+********************************************************************************/
+/************************************DEFINES***********************************/
+
+#define DECODE_TIMEOUT_MS   (DY_RX_TIMEOUT * 2)  /* Oldest query an answer may match */
+#define DECODE_PENDING      16      /* Unanswered queries kept per opcode      */
+#define DECODE_NOTES        160     /* Command names of one record             */
+
+/************************************INCLUDES***********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "DYPlayer.h"
+#include "DYPlayer_Parser.h"
+#include "DYPlayer_Trace.h"
+
+/**
+ * Queries and answers of one opcode.
+ */
+typedef struct
+{
+    uint64_t pending[DECODE_PENDING];  /* Send times of unanswered queries       */
+    uint8_t  count;
+    uint32_t sent;
+    uint32_t answered;
+    uint32_t lost;
+    uint64_t rttMin;
+    uint64_t rttMax;
+    uint64_t rttSum;
+} Opcode_t;
+
+static Opcode_t   opcode[DY_PARSER_OPCODES];
+static DYParser_t txParser;
+static DYParser_t rxParser;
+static uint64_t   recordTime;          /* Ticks since the first record           */
+static double     ticksPerMs;
+static char       notes[DECODE_NOTES];
+
+static const char *const names[DY_PARSER_OPCODES] = {
+    [0x01] = "checkPlayState",     [0x02] = "play",                [0x03] = "pause",
+    [0x04] = "stop",               [0x05] = "previous",            [0x06] = "next",
+    [0x07] = "playSpecified",      [0x08] = "playSpecifiedPath",   [0x09] = "onlineDevices",
+    [0x0A] = "getPlayingDevice",   [0x0B] = "setPlayingDevice",    [0x0C] = "getSoundCount",
+    [0x0D] = "getPlayingSound",    [0x0E] = "previousDir last",    [0x0F] = "previousDir first",
+    [0x10] = "stopInterlude",      [0x11] = "getFirstInDir",       [0x12] = "getSoundCountDir",
+    [0x13] = "setVolume",          [0x14] = "volumeIncrease",      [0x15] = "volumeDecrease",
+    [0x16] = "interludeSpecified", [0x17] = "interludePath",       [0x18] = "setCycleMode",
+    [0x19] = "setCycleTimes",      [0x1A] = "setEq",               [0x1B] = "combinationPlay",
+    [0x1C] = "endCombinationPlay", [0x1F] = "select",
+};
+
+
+/*******************************************************************************
+  @func    : note
+  @param   : const char *text
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Append to the notes printed after the current record.
+********************************************************************************/
+static void note(const char *text) {
+    size_t used = strlen(notes);
+
+    snprintf(&notes[used], sizeof(notes) - used, "%s%s", (used > 0) ? ", " : "", text);
+}
+/*******************************************************************************
+  @func    : name
+  @param   : uint8_t op
+  @return  : const char *
+  @date	   : 16.10.26
+  @brief   : Method name of an opcode.
+********************************************************************************/
+static const char *name(uint8_t op) {
+    return (names[op] != NULL) ? names[op] : "?";
+}
+/*******************************************************************************
+  @func    : onTx
+  @param   : void *ctx, uint8_t op, const uint8_t *data, uint8_t len
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Frame sent, remember when in case an answer follows.
+********************************************************************************/
+static void onTx(void *ctx, uint8_t op, const uint8_t *data, uint8_t len) {
+    Opcode_t *o = &opcode[op];
+
+    (void)ctx;
+    (void)data;
+    (void)len;
+    note(name(op));
+    o->sent++;
+    if (o->count == DECODE_PENDING) {
+        memmove(&o->pending[0], &o->pending[1], sizeof(o->pending) - sizeof(o->pending[0]));
+        o->count--;
+    }
+    o->pending[o->count++] = recordTime;
+}
+/*******************************************************************************
+  @func    : onRx
+  @param   : void *ctx, uint8_t op, const uint8_t *data, uint8_t len
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Answer received, match it to its query.
+********************************************************************************/
+static void onRx(void *ctx, uint8_t op, const uint8_t *data, uint8_t len) {
+    Opcode_t *o     = &opcode[op];
+    uint32_t  value = 0;
+    char      text[64];
+
+    (void)ctx;
+    for (uint8_t i = 0; i < len; i++) {
+        value = (value << 8) | data[i];
+    }
+
+    /* Queries that timed out in the driver */
+    while ((o->count > 0) && ((recordTime - o->pending[0]) > (uint64_t)(DECODE_TIMEOUT_MS * ticksPerMs))) {
+        memmove(&o->pending[0], &o->pending[1], (o->count - 1) * sizeof(o->pending[0]));
+        o->count--;
+        o->lost++;
+    }
+
+    if (o->count == 0) {
+        snprintf(text, sizeof(text), "%s = %u, unsolicited", name(op), (unsigned)value);
+        note(text);
+        return;
+    }
+
+    uint64_t rtt = recordTime - o->pending[0];
+
+    memmove(&o->pending[0], &o->pending[1], (o->count - 1) * sizeof(o->pending[0]));
+    o->count--;
+    if ((o->answered == 0) || (rtt < o->rttMin)) o->rttMin = rtt;
+    if (rtt > o->rttMax)                         o->rttMax = rtt;
+    o->rttSum += rtt;
+    o->answered++;
+
+    snprintf(text, sizeof(text), "%s = %u, rtt %.3f ms", name(op), (unsigned)value, rtt / ticksPerMs);
+    note(text);
+}
+/*******************************************************************************
+  @func    : load
+  @param   : const char *path, long *size
+  @return  : uint8_t *
+  @date	   : 16.10.26
+  @brief   : Whole capture in memory, NULL on error.
+********************************************************************************/
+static uint8_t *load(const char *path, long *size) {
+    FILE    *f = fopen(path, "rb");
+    uint8_t *data;
+
+    if (f == NULL) {
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    *size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    data = malloc((*size > 0) ? (size_t)*size : 1U);
+    if ((data != NULL) && (fread(data, 1, (size_t)*size, f) != (size_t)*size)) {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    return data;
+}
+/*******************************************************************************
+  @func    : u32
+  @param   : const uint8_t *p
+  @return  : uint32_t
+  @date	   : 16.10.26
+  @brief   : Little endian field.
+********************************************************************************/
+static uint32_t u32(const uint8_t *p) {
+    return p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+/*******************************************************************************
+  @func    : summary
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Sent, answered, lost and round trip times per opcode.
+********************************************************************************/
+static void summary(void) {
+    printf("\nop  command              sent  answered  lost   rtt min     mean      max ms\n");
+    for (int op = 0; op < DY_PARSER_OPCODES; op++) {
+        Opcode_t *o = &opcode[op];
+
+        if (o->sent == 0) {
+            continue;
+        }
+        /* Only opcodes that were answered are queries, others never lose one */
+        printf("%02X  %-19s %5u  %8u  %4u", op, name((uint8_t)op), (unsigned)o->sent,
+               (unsigned)o->answered, (unsigned)(o->lost + ((o->answered > 0) ? o->count : 0)));
+        if (o->answered > 0) {
+            printf("  %8.3f %8.3f %8.3f", o->rttMin / ticksPerMs,
+                   (o->rttSum / (double)o->answered) / ticksPerMs, o->rttMax / ticksPerMs);
+        }
+        printf("\n");
+    }
+}
+/*******************************************************************************
+  @func    : main
+  @param   : int argc, char **argv
+  @return  : int
+  @date	   : 16.10.26
+  @brief   : Decode the capture given on the command line.
+********************************************************************************/
+int main(int argc, char **argv) {
+    long     size = 0;
+    uint8_t *data;
+    long     at;
+
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s capture.bin\n", argv[0]);
+        return 2;
+    }
+    data = load(argv[1], &size);
+    if (data == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    for (at = 0; (at + DY_TRACE_HEADER_LEN) <= size; at++) {
+        if ((memcmp(&data[at], "DYTR", 4) == 0) && (data[at + 4] == DY_TRACE_VERSION)) {
+            break;
+        }
+    }
+    if ((at + DY_TRACE_HEADER_LEN) > size) {
+        fprintf(stderr, "%s: no trace header\n", argv[1]);
+        return 1;
+    }
+
+    uint32_t clockHz = u32(&data[at + 8]);
+    uint32_t dropped = u32(&data[at + 12]);
+    uint32_t bytes   = u32(&data[at + 16]);
+    long     end     = at + DY_TRACE_HEADER_LEN + (long)bytes;
+
+    if ((clockHz == 0) || (end > size)) {
+        fprintf(stderr, "%s: bad or truncated trace\n", argv[1]);
+        return 1;
+    }
+    ticksPerMs = clockHz / 1000.0;
+    printf("%u bytes of records, clock %u Hz, %u older records dropped\n\n",
+           (unsigned)bytes, (unsigned)clockHz, (unsigned)dropped);
+    printf("     time ms  dir  bytes\n");
+
+    DYParser_Init(&txParser);
+    DYParser_SetFallback(&txParser, onTx, NULL);
+    DYParser_Init(&rxParser);
+    DYParser_SetFallback(&rxParser, onRx, NULL);
+
+    bool     started = false;
+    uint32_t last    = 0;
+
+    for (at += DY_TRACE_HEADER_LEN; at < end; ) {
+        uint8_t  header = data[at];
+        uint8_t  len    = header & DY_TRACE_LEN_MASK;
+        uint32_t stamp;
+        bool     rx     = (header & DY_TRACE_RX) != 0;
+
+        if ((at + 5 + len) > end) {
+            fprintf(stderr, "truncated record at byte %ld\n", at);
+            break;
+        }
+        stamp = u32(&data[at + 1]);
+        if (!started) {
+            started = true;
+            last    = stamp;
+        }
+        /* The counter wraps, records are in order */
+        recordTime += (uint32_t)(stamp - last);
+        last = stamp;
+
+        notes[0] = '\0';
+        printf("%12.3f  %s  ", recordTime / ticksPerMs, rx ? "RX" : "TX");
+        for (uint8_t i = 0; i < len; i++) {
+            printf("%02X ", data[at + 5 + i]);
+        }
+        DYParser_FeedBlock(rx ? &rxParser : &txParser, &data[at + 5], len);
+        if (notes[0] != '\0') {
+            printf(" %s", notes);
+        }
+        printf("\n");
+        at += 5 + len;
+    }
+
+    summary();
+    free(data);
+    return 0;
+}
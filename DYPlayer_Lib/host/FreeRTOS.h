@@ -0,0 +1,38 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    FreeRTOS.h
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Host shim of the FreeRTOS calls DYPlayer_RTOS uses, on POSIX
+  *          threads (DYRtos_Posix.c). Tasks are threads, priorities and
+  *          stack sizes are ignored, one tick is 1 ms. Build with -pthread.
+  *          Not a scheduler: tasks really run in parallel.
+********************************************************************************/
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+/************************************INCLUDES***********************************/
+
+#include <stdint.h>
+#include <stddef.h>
+
+/************************************DEFINES***********************************/
+
+#define configTICK_RATE_HZ  1000
+#define portMAX_DELAY       ((TickType_t)0xFFFFFFFFU)
+#define pdMS_TO_TICKS(ms)   ((TickType_t)(((uint64_t)(ms) * configTICK_RATE_HZ) / 1000U))
+
+#define pdFALSE             ((BaseType_t)0)
+#define pdTRUE              ((BaseType_t)1)
+#define pdFAIL              pdFALSE
+#define pdPASS              pdTRUE
+
+#define portYIELD_FROM_ISR(x)   ((void)(x))
+
+typedef uint32_t      TickType_t;
+typedef long          BaseType_t;
+typedef unsigned long UBaseType_t;
+
+#endif /* FREERTOS_H */
@@ -0,0 +1,43 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    main.h
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Register level stand-in of the STM32F4 USART for host tests of
+  *          DYPlayer_UartIT.c: only SR, DR and CR1 and the bits it uses. The
+  *          test plays the shift register and the NVIC itself.
+********************************************************************************/
+#ifndef MAIN_H
+#define MAIN_H
+
+/************************************INCLUDES***********************************/
+
+#include <stdint.h>
+#include <stddef.h>
+
+/************************************DEFINES***********************************/
+
+#define USART_SR_TC         (1UL << 6)
+#define USART_SR_TXE        (1UL << 7)
+#define USART_CR1_TCIE      (1UL << 6)
+#define USART_CR1_TXEIE     (1UL << 7)
+
+#define READ_REG(REG)               ((REG))
+#define ATOMIC_SET_BIT(REG, BIT)    ((REG) |= (BIT))
+#define ATOMIC_CLEAR_BIT(REG, BIT)  ((REG) &= ~(BIT))
+
+typedef struct
+{
+    volatile uint32_t SR;
+    volatile uint32_t DR;
+    volatile uint32_t CR1;
+} USART_TypeDef;
+
+typedef struct
+{
+    USART_TypeDef *Instance;
+} UART_HandleTypeDef;
+
+#endif /* MAIN_H */
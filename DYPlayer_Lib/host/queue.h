@@ -0,0 +1,27 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    queue.h
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Host shim of FreeRTOS queues, items are copied in and out.
+********************************************************************************/
+#ifndef QUEUE_H
+#define QUEUE_H
+
+/************************************INCLUDES***********************************/
+
+#include "FreeRTOS.h"
+
+typedef struct QueueDefinition *QueueHandle_t;
+
+/**
+ * Function Declerations
+ */
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize);
+BaseType_t    xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks);
+BaseType_t    xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks);
+UBaseType_t   uxQueueMessagesWaiting(QueueHandle_t queue);
+
+#endif /* QUEUE_H */
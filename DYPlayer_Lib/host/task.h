@@ -0,0 +1,57 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    task.h
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Host shim of FreeRTOS tasks and direct-to-task notifications.
+  *          A thread not made by xTaskCreate() (e.g. main) gets a handle on
+  *          its first xTaskGetCurrentTaskHandle().
+********************************************************************************/
+#ifndef TASK_H
+#define TASK_H
+
+/************************************INCLUDES***********************************/
+
+#include "FreeRTOS.h"
+
+/************************************DEFINES***********************************/
+
+#define tskIDLE_PRIORITY    ((UBaseType_t)0)
+
+#define taskENTER_CRITICAL()    vTaskEnterCritical()
+#define taskEXIT_CRITICAL()     vTaskExitCritical()
+
+typedef struct tskTaskControlBlock *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *param);
+
+typedef enum
+{
+    eNoAction = 0,
+    eSetBits,
+    eIncrement,
+    eSetValueWithOverwrite,
+    eSetValueWithoutOverwrite
+} eNotifyAction;
+
+/**
+ * Function Declerations
+ */
+BaseType_t    xTaskCreate(TaskFunction_t code, const char *name, uint16_t stackDepth,
+                          void *param, UBaseType_t priority, TaskHandle_t *created);
+TaskHandle_t  xTaskGetCurrentTaskHandle(void);
+TickType_t    xTaskGetTickCount(void);
+void          vTaskDelay(TickType_t ticks);
+BaseType_t    xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action);
+BaseType_t    xTaskNotifyGive(TaskHandle_t task);
+void          vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken);
+uint32_t      ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks);
+BaseType_t    xTaskNotifyWait(uint32_t clearOnEntry, uint32_t clearOnExit, uint32_t *value,
+                              TickType_t ticks);
+BaseType_t    xTaskNotifyStateClear(TaskHandle_t task);
+uint32_t      ulTaskNotifyValueClear(TaskHandle_t task, uint32_t bits);
+void          vTaskEnterCritical(void);
+void          vTaskExitCritical(void);
+
+#endif /* TASK_H */
@@ -0,0 +1,178 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_Async.h
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Non-blocking command queue. Commands and queries are submitted to
+  *          a bounded queue and DYAsync_Process() moves them along whenever
+  *          it is called; results come back by callback, by a polled future,
+  *          or both.
+  *
+  *          Queries can be pipelined: with a depth above 1 the next frames
+  *          leave while answers are still outstanding, and answers are
+  *          matched to their query by opcode.
+  *
+  *          Frames are handed to the transport at wire speed, so the ones
+  *          still queued can be coalesced: runs of volume steps become one
+  *          setVolume, a playSpecified/select followed by another one is
+  *          dropped. Dropped commands still complete, as DY_ASYNC_DONE.
+  *
+  *          pause, stop and stop interlude take an urgent lane: they go out
+  *          at the next frame boundary, ahead of queued queries and setup,
+  *          without waiting for answers in flight.
+  *
+  *          A query left unanswered for DY_RX_TIMEOUT is sent again up to
+  *          `retries` times before it times out.
+  *
+  *          DYAsync_Init() hooks the queue into DYPlayer_Process(), the one
+  *          tick of the instance for a superloop, a SysTick scheduler or an
+  *          RTOS task.
+  *
+  *          Submit from one context and process from one context (e.g. main
+  *          loop and timer ISR). Don't mix with the blocking `DYPlayer` calls
+  *          on the same instance while commands are pending.
+********************************************************************************/
+#ifndef DYPLAYER_ASYNC_H
+#define DYPLAYER_ASYNC_H
+
+/************************************DEFINES***********************************/
+
+#ifndef DY_ASYNC_QUEUE_LEN
+#define DY_ASYNC_QUEUE_LEN  8       /* Pending commands, power of 2            */
+#endif
+
+#ifndef DY_ASYNC_FRAME_MAX
+#define DY_ASYNC_FRAME_MAX  DY_FRAME_MAX /* Longest queued frame, paths included */
+#endif
+
+#ifndef DY_ASYNC_DEPTH
+#define DY_ASYNC_DEPTH      1       /* Frames on the wire at once, default     */
+#endif
+
+#ifndef DY_ASYNC_URGENT_LEN
+#define DY_ASYNC_URGENT_LEN 4       /* Urgent lane, power of 2                 */
+#endif
+
+#ifndef DY_ASYNC_RETRIES
+#define DY_ASYNC_RETRIES    0       /* Resends of an unanswered query, default */
+#endif
+
+#ifndef DY_ASYNC_BYTE_US
+#define DY_ASYNC_BYTE_US    1042    /* us per byte on the wire, 9600 8N1       */
+#endif
+
+/************************************INCLUDES***********************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "DYPlayer.h"
+
+/**
+ * Command life cycle, also the result given to callbacks.
+ */
+typedef enum
+{
+    DY_ASYNC_FREE    = 0,   /* Future not in use                                */
+    DY_ASYNC_QUEUED,        /* Waiting for its turn                             */
+    DY_ASYNC_SENT,          /* On the wire, waiting for the answer              */
+    DY_ASYNC_DONE,          /* Sent; for queries the answer is in `value`       */
+    DY_ASYNC_TIMEOUT,       /* No answer within DY_RX_TIMEOUT                   */
+    DY_ASYNC_CANCELLED      /* Dropped unsent by DYAsync_Cancel()               */
+} DYAsyncStatus_t;
+
+/*
+ * Completion callback, called from DYAsync_Process(). `value` is the answer
+ * of a query (state, device or 16 bit number), 0 for other commands.
+ */
+typedef void (*DYAsync_Callback_t)(void *ctx, DYAsyncStatus_t status, uint16_t value);
+
+/**
+ * Polled result. Owned by the caller, must live until it left the queue.
+ */
+typedef struct
+{
+    volatile DYAsyncStatus_t status;
+    volatile uint16_t        value;
+} DYFuture_t;
+
+/**
+ * Queued command.
+ */
+typedef struct
+{
+    uint8_t            frame[DY_ASYNC_FRAME_MAX];
+    uint8_t            len;
+    uint8_t            sent;            /* Bytes the transport took so far     */
+    uint8_t            response;        /* Opcode of the answer, 0 = none      */
+    uint8_t            status;          /* DYAsyncStatus_t of this slot        */
+    uint8_t            tries;           /* Resends so far                      */
+    uint32_t           sentAt;          /* Transport time of the last byte, us */
+    DYAsync_Callback_t callback;
+    void              *ctx;
+    DYFuture_t        *future;
+} DYAsyncCmd_t;
+
+/**
+ * Queue of one driver instance. Slots from `tail` to `next` are on the wire,
+ * from `next` to `head` waiting to be sent.
+ */
+typedef struct
+{
+    DYPlayer_t        *player;
+    DYAsyncCmd_t       queue[DY_ASYNC_QUEUE_LEN];
+    volatile uint8_t   head;            /* Next free slot, written by submit   */
+    volatile uint8_t   tail;            /* Oldest command, written by process  */
+    uint8_t            next;            /* Next command to send                */
+    uint8_t            inflight;        /* Sent, not finished yet              */
+    uint8_t            depth;           /* Limit of `inflight`                 */
+    bool               coalesce;        /* Merge queued frames before sending  */
+    bool               priority;        /* Urgent commands take their lane     */
+    volatile bool      cancel;          /* DYAsync_Cancel() pending            */
+    volatile uint8_t   cancelTo;        /* `head` when it was called           */
+    uint32_t           readyAt;         /* Last frame is off the wire, us      */
+    uint8_t            retries;         /* Resends allowed per query           */
+
+    DYAsyncCmd_t      *resend;          /* Query being sent again, NULL = none */
+    uint8_t            resendFrame[DY_ASYNC_FRAME_MAX];
+    uint8_t            resendLen;       /* Copy on the way, 0 = none           */
+    uint8_t            resendSent;
+
+    DYAsyncCmd_t       urgent[DY_ASYNC_URGENT_LEN];
+    volatile uint8_t   urgentHead;
+    volatile uint8_t   urgentTail;
+
+    uint32_t           completed;
+    uint32_t           timeouts;        /* Unanswered or answer overtaken      */
+    uint32_t           coalesced;       /* Completed without being sent        */
+    uint32_t           resent;          /* Queries sent again                  */
+} DYAsync_t;
+
+/**
+ * Function Declerations
+ */
+void          DYAsync_Init(DYAsync_t *async, DYPlayer_t *player);
+bool          DYAsync_Submit(DYAsync_t *async, const uint8_t *frame, uint8_t len, uint8_t response,
+                             DYAsync_Callback_t callback, void *ctx, DYFuture_t *future);
+bool          DYAsync_SubmitFrame(DYAsync_t *async, DYFrame_t *frame,
+                                  DYAsync_Callback_t callback, void *ctx, DYFuture_t *future);
+bool          DYAsync_Control(DYAsync_t *async, uint8_t index,
+                              DYAsync_Callback_t callback, void *ctx, DYFuture_t *future);
+bool          DYAsync_SetVolume(DYAsync_t *async, uint8_t volume,
+                                DYAsync_Callback_t callback, void *ctx, DYFuture_t *future);
+bool          DYAsync_PlaySpecified(DYAsync_t *async, uint16_t number,
+                                    DYAsync_Callback_t callback, void *ctx, DYFuture_t *future);
+bool          DYAsync_Select(DYAsync_t *async, uint16_t number,
+                             DYAsync_Callback_t callback, void *ctx, DYFuture_t *future);
+void          DYAsync_SetDepth(DYAsync_t *async, uint8_t depth);
+void          DYAsync_SetCoalescing(DYAsync_t *async, bool enable);
+void          DYAsync_SetPriority(DYAsync_t *async, bool enable);
+void          DYAsync_SetRetries(DYAsync_t *async, uint8_t retries);
+void          DYAsync_Cancel(DYAsync_t *async);
+uint8_t       DYAsync_Pending(const DYAsync_t *async);
+void          DYAsync_Process(DYAsync_t *async);
+bool          DYFuture_Ready(const DYFuture_t *future);
+
+#endif /* DYPLAYER_ASYNC_H */
@@ -0,0 +1,87 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_Busy.h
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 BUSY pin monitor. The module drives BUSY while audio comes out
+  *          (low on the DY-HV20T, see Datasheet/DY-HV20T_WorkModes.png), so
+  *          play state and track ends can be followed without UART traffic.
+  *
+  *          DYBusy_Edge() is called from the pin interrupt with the level and
+  *          a time stamp. A level counts once it held for `debounce`: the
+  *          next DYBusy_Poll() after that takes it, stamped with the time of
+  *          its edge, or the next edge if no Poll came in between. A pulse
+  *          shorter than `debounce` is bounce and raises no event, so a
+  *          glitch on the pin doesn't end a track. Poll also catches edges
+  *          the interrupt missed, or replaces it when the pin is only
+  *          polled. Call it often, or from a timer `debounce` after each
+  *          edge: an event is seen that long after the edge at the earliest.
+  *
+  *          Edge may preempt Poll. On Cortex-M Poll masks interrupts
+  *          (PRIMASK) for its few instructions of state update, so the two
+  *          never interleave; on other targets call Edge and Poll from the
+  *          same priority, or mask the pin interrupt around Poll. Callbacks
+  *          run after the update, unmasked, in the context of the call that
+  *          changed the state, so keep them short in the interrupt.
+********************************************************************************/
+#ifndef DYPLAYER_BUSY_H
+#define DYPLAYER_BUSY_H
+
+/************************************DEFINES***********************************/
+
+#ifndef DY_BUSY_DEBOUNCE_US
+#define DY_BUSY_DEBOUNCE_US 1000    /* Hold time before a level counts         */
+#endif
+
+/************************************INCLUDES***********************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Events given to the callback.
+ */
+typedef enum
+{
+    DY_BUSY_STARTED = 0,    /* Audio started, a track or an interlude            */
+    DY_BUSY_ENDED           /* Audio ended: track over, stopped or paused        */
+} DYBusyEvent_t;
+
+/*
+ * Edge callback, `time` is the stamp of the edge in the caller's clock.
+ */
+typedef void (*DYBusy_Callback_t)(void *ctx, DYBusyEvent_t event, uint32_t time);
+
+/**
+ * Monitor of one BUSY pin. Times are in the unit of the stamps passed in,
+ * e.g. DWT cycles or us.
+ */
+typedef struct
+{
+    bool               activeLow;     /* Pin level while playing is low         */
+    uint32_t           debounce;      /* Hold time before a level counts        */
+    DYBusy_Callback_t  callback;
+    void              *ctx;
+
+    volatile bool      playing;       /* Debounced state                        */
+    volatile bool      level;         /* Last level seen, counts once it held   */
+    volatile uint32_t  edgeAt;        /* Time of the last edge seen             */
+    volatile uint32_t  startedAt;     /* Time of the last DY_BUSY_STARTED       */
+    volatile uint32_t  endedAt;       /* Time of the last DY_BUSY_ENDED         */
+    volatile uint32_t  starts;
+    volatile uint32_t  ends;
+    volatile uint32_t  bounces;       /* Edges ending a level held too short    */
+} DYBusy_t;
+
+/**
+ * Function Declerations
+ */
+void          DYBusy_Init(DYBusy_t *busy, bool activeLow, uint32_t debounce, bool level, uint32_t now);
+void          DYBusy_SetCallback(DYBusy_t *busy, DYBusy_Callback_t callback, void *ctx);
+void          DYBusy_Edge(DYBusy_t *busy, bool level, uint32_t now);
+void          DYBusy_Poll(DYBusy_t *busy, bool level, uint32_t now);
+bool          DYBusy_Playing(const DYBusy_t *busy);
+
+#endif /* DYPLAYER_BUSY_H */
@@ -0,0 +1,51 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_Frame.h
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Builds a complete DY-XXXX command frame, header to checksum, in one
+  *          contiguous buffer so it can leave in a single UART transaction.
+********************************************************************************/
+#ifndef DYPLAYER_FRAME_H
+#define DYPLAYER_FRAME_H
+
+/************************************DEFINES***********************************/
+
+#ifndef DY_FRAME_MAX
+#define DY_FRAME_MAX        64      /* AA, cmd, len, up to 60 data bytes, SM.  */
+#endif
+
+#define DY_FRAME_HEADER     0xAA    /* First byte of every frame.              */
+#define DY_FRAME_LEN_INDEX  2       /* Index of the data length byte.          */
+#define DY_FRAME_OVERHEAD   4       /* AA, cmd, len and SM.                    */
+
+/************************************INCLUDES***********************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Frame under construction. `sum` is the running checksum of every byte put
+ * so far, the length byte is added when the frame is closed.
+ */
+typedef struct
+{
+    uint8_t data[DY_FRAME_MAX];   /* Frame bytes                                */
+    uint8_t len;                  /* Bytes used, including SM once ended        */
+    uint8_t sum;                  /* Running checksum                           */
+    bool    overflow;             /* Set when a put did not fit, frame invalid  */
+} DYFrame_t;
+
+/**
+ * Function Declerations
+ */
+void          DYFrame_Begin(DYFrame_t *frame, uint8_t command);
+void          DYFrame_PutByte(DYFrame_t *frame, uint8_t byte);
+void          DYFrame_PutWord(DYFrame_t *frame, uint16_t word);
+void          DYFrame_PutBytes(DYFrame_t *frame, const uint8_t *data, uint8_t len);
+void          DYFrame_PutPath(DYFrame_t *frame, const char *path);
+uint8_t       DYFrame_End(DYFrame_t *frame);
+
+#endif /* DYPLAYER_FRAME_H */
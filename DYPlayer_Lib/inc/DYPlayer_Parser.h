@@ -0,0 +1,70 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_Parser.h
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Byte at a time parser of DY-XXXX frames (AA, opcode, length, data,
+  *          SM). Bytes can come straight from an ISR or a DMA ring. After a
+  *          bad checksum it resyncs on the next 0xAA, also inside the bytes it
+  *          already has, so a lost or extra byte costs one frame at most.
+********************************************************************************/
+#ifndef DYPLAYER_PARSER_H
+#define DYPLAYER_PARSER_H
+
+/************************************DEFINES***********************************/
+
+#define DY_PARSER_OPCODES   0x20    /* Handlers for opcodes 0x00..0x1F         */
+
+#ifndef DY_PARSER_MAX_DATA
+#define DY_PARSER_MAX_DATA  8       /* Longer length bytes are noise, modules  */
+#endif                              /* answer with 1 or 2 data bytes.          */
+
+/************************************INCLUDES***********************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "DYPlayer_Frame.h"
+
+/*
+ * Called for every complete frame with a valid checksum. `data` points to
+ * the `len` data bytes, it is only valid during the call.
+ */
+typedef void (*DYParser_Handler_t)(void *ctx, uint8_t opcode, const uint8_t *data, uint8_t len);
+
+/**
+ * Parser state, the last complete frame stays in `frame` until the next
+ * byte is fed.
+ */
+typedef struct
+{
+    uint8_t            frame[DY_FRAME_MAX];    /* Frame being collected        */
+    uint8_t            len;                    /* Bytes in `frame`             */
+    uint8_t            sum;                    /* Running checksum             */
+    bool               complete;               /* `frame` holds a valid frame  */
+    uint8_t            work[DY_FRAME_MAX];     /* Bytes to parse again         */
+    uint8_t            replay;                 /* Bytes in `work`              */
+
+    DYParser_Handler_t handler[DY_PARSER_OPCODES];
+    void              *handlerCtx[DY_PARSER_OPCODES];
+    DYParser_Handler_t fallback;               /* Opcodes without a handler    */
+    void              *fallbackCtx;
+
+    uint32_t           frames;                 /* Valid frames                 */
+    uint32_t           crcErrors;              /* Bad checksum or length       */
+    uint32_t           skipped;                /* Bytes dropped while syncing  */
+} DYParser_t;
+
+/**
+ * Function Declerations
+ */
+void          DYParser_Init(DYParser_t *parser);
+void          DYParser_Reset(DYParser_t *parser);
+void          DYParser_SetHandler(DYParser_t *parser, uint8_t opcode, DYParser_Handler_t handler, void *ctx);
+void          DYParser_SetFallback(DYParser_t *parser, DYParser_Handler_t handler, void *ctx);
+bool          DYParser_Feed(DYParser_t *parser, uint8_t byte);
+uint16_t      DYParser_FeedBlock(DYParser_t *parser, const uint8_t *data, uint16_t len);
+
+#endif /* DYPLAYER_PARSER_H */
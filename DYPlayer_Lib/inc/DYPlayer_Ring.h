@@ -0,0 +1,54 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_Ring.h
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Lock-free single producer / single consumer byte ring used between
+  *          the driver (producer) and the UART interrupt (consumer).
+********************************************************************************/
+#ifndef DYPLAYER_RING_H
+#define DYPLAYER_RING_H
+
+/************************************INCLUDES***********************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/************************************DEFINES***********************************/
+
+/*
+ * Orders the buffer accesses against the index update. On Cortex-M4 a DMB is
+ * enough, the host build falls back to a full compiler/CPU barrier.
+ */
+#if defined(__ARM_ARCH)
+#define DY_RING_BARRIER()   __asm volatile ("dmb" ::: "memory")
+#else
+#define DY_RING_BARRIER()   __sync_synchronize()
+#endif
+
+/**
+ * Ring descriptor. `head` is only written by the producer and `tail` only by
+ * the consumer, so no interrupt locking is needed. Both are free running and
+ * wrap at 65536, size must be a power of two.
+ */
+typedef struct
+{
+    uint8_t           *buffer;  /* Storage, `size` bytes long.                 */
+    uint16_t           size;    /* Power of two, 2 .. 32768.                   */
+    volatile uint16_t  head;    /* Next write position (producer owned).       */
+    volatile uint16_t  tail;    /* Next read position (consumer owned).        */
+} DYRing_t;
+
+/**
+ * Function Declerations
+ */
+void          DYRing_Init(DYRing_t *ring, uint8_t *buffer, uint16_t size);
+uint16_t      DYRing_Count(const DYRing_t *ring);
+uint16_t      DYRing_Space(const DYRing_t *ring);
+bool          DYRing_Write(DYRing_t *ring, const uint8_t *data, uint16_t len);
+uint16_t      DYRing_Read(DYRing_t *ring, uint8_t *data, uint16_t len);
+bool          DYRing_Get(DYRing_t *ring, uint8_t *byte);
+
+#endif /* DYPLAYER_RING_H */
@@ -0,0 +1,79 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_RxQueue.h
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Wait-free single producer / single consumer queue of complete
+  *          answer frames, from the UART interrupt (producer) to the
+  *          application or driver task (consumer). Neither side disables
+  *          interrupts or ever waits: a full queue drops the new frame, an
+  *          empty one returns nothing.
+  *
+  *          Slots have a fixed size, so a frame is written in place with
+  *          DYRxQueue_Reserve() / DYRxQueue_Commit() and read in place with
+  *          DYRxQueue_Peek() / DYRxQueue_Release(); Push and Pop copy.
+  *
+  *          Ordering: the producer fills the slot, then publishes `head`
+  *          with release semantics; the consumer reads `head` with acquire
+  *          semantics before it touches the slot, and gives the slot back
+  *          the same way through `tail`. ARMv7-M allows normal memory
+  *          accesses to be reordered (the Cortex-M4 core itself doesn't), so
+  *          a DMB sits on each side of the index access, which is also the
+  *          compiler barrier. Aligned halfword indexes are single-copy atomic.
+  *          Host builds use the GCC __atomic acquire/release builtins.
+********************************************************************************/
+#ifndef DYPLAYER_RXQUEUE_H
+#define DYPLAYER_RXQUEUE_H
+
+/************************************INCLUDES***********************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "DYPlayer_Parser.h"
+
+/************************************DEFINES***********************************/
+
+#ifndef DY_RXQ_LEN
+#define DY_RXQ_LEN          8       /* Frames, power of 2                      */
+#endif
+
+/* AA, opcode, length, the longest data the parser accepts, SM. */
+#define DY_RXQ_FRAME_SIZE   (DY_PARSER_MAX_DATA + 4)
+
+/**
+ * One answer frame, checksum included.
+ */
+typedef struct
+{
+    uint8_t            len;
+    uint8_t            data[DY_RXQ_FRAME_SIZE];
+} DYRxFrame_t;
+
+/**
+ * Queue descriptor. `head` and `dropped` are only written by the producer,
+ * `tail` only by the consumer. Both indexes are free running.
+ */
+typedef struct
+{
+    DYRxFrame_t        slot[DY_RXQ_LEN];
+    volatile uint16_t  head;            /* Next slot to fill (producer owned)  */
+    volatile uint16_t  tail;            /* Oldest frame (consumer owned)       */
+    volatile uint32_t  dropped;         /* Frames lost to a full queue         */
+} DYRxQueue_t;
+
+/**
+ * Function Declerations
+ */
+void               DYRxQueue_Init(DYRxQueue_t *queue);
+uint16_t           DYRxQueue_Count(const DYRxQueue_t *queue);
+DYRxFrame_t       *DYRxQueue_Reserve(DYRxQueue_t *queue);
+void               DYRxQueue_Commit(DYRxQueue_t *queue);
+bool               DYRxQueue_Push(DYRxQueue_t *queue, const uint8_t *frame, uint8_t len);
+const DYRxFrame_t *DYRxQueue_Peek(const DYRxQueue_t *queue);
+void               DYRxQueue_Release(DYRxQueue_t *queue);
+bool               DYRxQueue_Pop(DYRxQueue_t *queue, DYRxFrame_t *frame);
+
+#endif /* DYPLAYER_RXQUEUE_H */
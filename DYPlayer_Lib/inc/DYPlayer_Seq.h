@@ -0,0 +1,78 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_Seq.h
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Back to back playback of a list of tracks, started by the BUSY
+  *          pin instead of polling checkPlayState().
+  *
+  *          Once a track started the frame of the next one is built and kept
+  *          armed. DYSeq_Busy(), the DYBusy_t callback, hands it to the
+  *          transport once the track end held for the BUSY debounce, so the
+  *          gap is the debounce, the frame on the wire and the module start
+  *          up time. Poll the monitor often, or from a timer after an edge.
+  *          Arming waits for the start edge, so the end edge of whatever
+  *          played before DYSeq_Start() doesn't fire anything.
+  *
+  *          Arming can't use select (0x1F) on the module: it stops the
+  *          track that is playing. The armed frame is a playSpecified.
+  *
+  *          Use the IT or DMA transport, a blocking one would send from
+  *          the interrupt. DYSeq_Busy() runs from the EXTI and from
+  *          DYBusy_Poll(), each time with interrupts masked for the write
+  *          and its shadow and counter updates (a few us with DMA).
+  *
+  *          While the sequence runs DYSeq_Busy() owns the transport
+  *          producer of this module, the DMA queue `head` has only one.
+  *          Don't call the driver on this module then, except
+  *          checkPlayState() answered by BUSY; DYSeq_Stop() before pause()
+  *          or stop(), they end audio too.
+********************************************************************************/
+#ifndef DYPLAYER_SEQ_H
+#define DYPLAYER_SEQ_H
+
+/************************************DEFINES***********************************/
+
+#ifndef DY_SEQ_MAX
+#define DY_SEQ_MAX          16      /* Tracks of one sequence                  */
+#endif
+
+/************************************INCLUDES***********************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "DYPlayer.h"
+#include "DYPlayer_Busy.h"
+
+/**
+ * Sequence of tracks on one module.
+ */
+typedef struct
+{
+    DYPlayer_t        *player;
+    uint16_t           track[DY_SEQ_MAX];
+    uint8_t            count;
+    volatile uint8_t   next;          /* Index of the track to start next       */
+    volatile bool      running;
+    volatile bool      started;       /* Start edge of the current track seen   */
+    volatile bool      armed;         /* `frame` goes out on the next end edge  */
+    DYFrame_t          frame;         /* playSpecified of track[next]           */
+    volatile uint32_t  endedAt;       /* BUSY stamp of the last end edge        */
+    volatile uint32_t  fired;         /* Tracks started from the interrupt      */
+    volatile uint32_t  missed;        /* No room in the transport, sequence over */
+} DYSeq_t;
+
+/**
+ * Function Declerations
+ */
+void          DYSeq_Init(DYSeq_t *seq, DYPlayer_t *player);
+bool          DYSeq_Add(DYSeq_t *seq, uint16_t track);
+bool          DYSeq_Start(DYSeq_t *seq);
+void          DYSeq_Stop(DYSeq_t *seq);
+bool          DYSeq_Running(const DYSeq_t *seq);
+void          DYSeq_Busy(void *ctx, DYBusyEvent_t event, uint32_t time);
+
+#endif /* DYPLAYER_SEQ_H */
@@ -0,0 +1,97 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_Trace.h
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Wire trace recorder. `DYTransport_Trace` sits between the driver
+  *          and the real transport and logs every frame written and every
+  *          byte read, with a cycle counter time stamp, into a RAM ring.
+  *          When the ring is full the oldest records make room.
+  *
+  *          DYTrace_Dump() streams the ring in a compact binary format to a
+  *          sink, e.g. ITM or a debug UART (DYPlayer_PortSTM32.h), and
+  *          host/DYTrace_Decode.c turns it into a timeline with the round
+  *          trip time of every query.
+  *
+  *          TX records are stamped when the frame was handed to the
+  *          transport, RX records when the transport delivered the bytes.
+  *          A DMA receive port only hands checked frames to read(), so noise,
+  *          broken and extra bytes never reach the trace that way. Forward
+  *          its rxCallback to DYTrace_RecordRaw() instead: RX is then logged
+  *          raw from the UART interrupt, stamped at the IDLE line event, and
+  *          reads are no longer logged. Records are written with interrupts
+  *          masked on Cortex-M; on other targets record from one context.
+  *
+  *          Dump format, little endian:
+  *            "DYTR", version, 0, 0, 0, u32 clock Hz, u32 records dropped,
+  *            u32 record bytes, then the records oldest first:
+  *            u8 direction << 7 | length, u32 time stamp, length bytes.
+********************************************************************************/
+#ifndef DYPLAYER_TRACE_H
+#define DYPLAYER_TRACE_H
+
+/************************************DEFINES***********************************/
+
+#ifndef DY_TRACE
+#define DY_TRACE            0       /* Example traces the module UART          */
+#endif
+
+#ifndef DY_TRACE_SIZE
+#define DY_TRACE_SIZE       2048    /* Ring bytes, power of 2                  */
+#endif
+
+#define DY_TRACE_VERSION    1
+#define DY_TRACE_RX         0x80    /* Record header: module -> MCU            */
+#define DY_TRACE_LEN_MASK   0x7F    /* Record header: data bytes               */
+#define DY_TRACE_RECORD_MAX (1 + 4 + DY_TRACE_LEN_MASK)
+#define DY_TRACE_HEADER_LEN 20      /* Dump header bytes                       */
+
+/************************************INCLUDES***********************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "DYPlayer_Transport.h"
+
+/* Free running time stamp counter, e.g. DWT->CYCCNT */
+typedef uint32_t (*DYTrace_Clock_t)(void);
+
+/* Dump sink, takes `len` bytes in order */
+typedef void (*DYTrace_Out_t)(void *ctx, const uint8_t *data, uint16_t len);
+
+/**
+ * Recorder, also the context of `DYTransport_Trace`.
+ */
+typedef struct
+{
+    const DYTransport_st *transport;  /* Real transport underneath              */
+    void                 *ctx;        /* Its context                            */
+    DYTrace_Clock_t       clock;
+    uint32_t              clockHz;    /* Ticks of `clock` per second            */
+    volatile bool         enabled;
+    volatile bool         rawRx;      /* RX from DYTrace_RecordRaw, not reads   */
+    uint8_t               ring[DY_TRACE_SIZE];
+    uint32_t              head;       /* Next byte written, free running        */
+    uint32_t              tail;       /* First byte of the oldest record        */
+    uint32_t              dropped;    /* Records overwritten                    */
+} DYTrace_t;
+
+/**
+ * Function Declerations
+ */
+void          DYTrace_Init(DYTrace_t *trace, const DYTransport_st *transport, void *ctx,
+                           DYTrace_Clock_t clock, uint32_t clockHz);
+void          DYTrace_Enable(DYTrace_t *trace, bool enable);
+void          DYTrace_Clear(DYTrace_t *trace);
+void          DYTrace_Record(DYTrace_t *trace, bool rx, const uint8_t *data, uint16_t len);
+void          DYTrace_RecordRaw(DYTrace_t *trace, const uint8_t *data, uint16_t len);
+void          DYTrace_Dump(const DYTrace_t *trace, DYTrace_Out_t out, void *ctx);
+
+/**
+ * Method pointer struct implementation, context is a DYTrace_t
+ */
+extern const DYTransport_st DYTransport_Trace;
+
+#endif /* DYPLAYER_TRACE_H */
@@ -0,0 +1,38 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_Transport.h
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Transport operations the driver uses to reach a module. A backend
+  *          (blocking HAL, interrupt, DMA, host serial, simulator) fills one
+  *          const table, the driver never touches the UART directly.
+********************************************************************************/
+#ifndef DYPLAYER_TRANSPORT_H
+#define DYPLAYER_TRANSPORT_H
+
+/************************************INCLUDES***********************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Method pointer-function struct definition. Times are in microseconds, `ctx`
+ * is the backend context given to DYPlayer_Init().
+ */
+typedef struct
+{
+    /* Accept up to `len` bytes for transmission, returns the amount taken.
+       Non-blocking backends return 0 while their queue is full.            */
+    uint16_t (*write)(void *ctx, const uint8_t *data, uint16_t len);
+    /* Read up to `len` bytes, waiting at most `timeout` us in total.
+       Returns the amount read, `timeout` 0 only takes what is there.       */
+    uint16_t (*read)(void *ctx, uint8_t *buffer, uint16_t len, uint32_t timeout);
+    /* Free running time stamp, wraps at 2^32 us.                           */
+    uint32_t (*now)(void *ctx);
+    /* Let at least `us` microseconds pass.                                 */
+    void     (*wait)(void *ctx, uint32_t us);
+} DYTransport_st;
+
+#endif /* DYPLAYER_TRANSPORT_H */
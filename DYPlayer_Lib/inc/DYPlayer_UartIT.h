@@ -0,0 +1,49 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_UartIT.h
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Interrupt driven, non-blocking UART transmit path. Frames are put
+  *          into a lock-free ring and drained by the TXE/TC interrupt.
+  *          The port owns TXEIE and TCIE of its UART, so the HAL transmit
+  *          interrupt calls (HAL_UART_Transmit_IT) must not be used on it.
+********************************************************************************/
+#ifndef DYPLAYER_UARTIT_H
+#define DYPLAYER_UARTIT_H
+
+/************************************DEFINES***********************************/
+
+#ifndef DY_TX_RING_SIZE
+#define DY_TX_RING_SIZE     128     /* Power of two, fits a few path frames.  */
+#endif
+
+/************************************INCLUDES***********************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "main.h"
+#include "DYPlayer_Ring.h"
+
+/**
+ * One interrupt driven transmit port, one per UART.
+ */
+typedef struct
+{
+    UART_HandleTypeDef *huart;                      /* HAL handle, peripheral registers */
+    DYRing_t            tx;                         /* Pending bytes                    */
+    volatile bool       busy;                       /* Set until the last stop bit left */
+    uint8_t             txBuffer[DY_TX_RING_SIZE];  /* Ring storage                     */
+} DYUartIT_t;
+
+/**
+ * Function Declerations
+ */
+void          DYPlayer_UartIT_Init(DYUartIT_t *port, UART_HandleTypeDef *huart);
+bool          DYPlayer_UartIT_Write(DYUartIT_t *port, const uint8_t *data, uint16_t len);
+bool          DYPlayer_UartIT_Busy(DYUartIT_t *port);
+void          DYPlayer_UartIT_IRQHandler(DYUartIT_t *port);
+
+#endif /* DYPLAYER_UARTIT_H */
@@ -7,49 +7,351 @@
   * @rev     V1.0.0
   * @brief	 UART Control of DY-XXXX mp3 modules C Driver
 ********************************************************************************/
-/************************************DEFINES***********************************/
+/************************************INCLUDES***********************************/
+#include "DYPlayer.h"
+#include "DYPlayer_Stats.h"
 
+/******************************************************************************/
+/**
+ * Method pointer struct implementation, timing wrappers with DY_STATS
+ */
+const DYPlayer_st DYPlayer    = {
+    DY_STATS_ENTRY(serialWrite),
+    DY_STATS_ENTRY(serialWrite_crc),
+    DY_STATS_ENTRY(serialRead),
+    DY_STATS_ENTRY(checkPlayState),
+    DY_STATS_ENTRY(play),
+    DY_STATS_ENTRY(pause),
+    DY_STATS_ENTRY(stop),
+    DY_STATS_ENTRY(previous),
+    DY_STATS_ENTRY(next),
+    DY_STATS_ENTRY(playSpecified),
+    DY_STATS_ENTRY(playSpecifiedDevicePath),
+    DY_STATS_ENTRY(getPlayingDevice),
+    DY_STATS_ENTRY(setPlayingDevice),
+    DY_STATS_ENTRY(getSoundCount),
+    DY_STATS_ENTRY(getPlayingSound),
+    DY_STATS_ENTRY(previousDir),
+    DY_STATS_ENTRY(getFirstInDir),
+    DY_STATS_ENTRY(getSoundCountDir),
+    DY_STATS_ENTRY(setVolume),
+    DY_STATS_ENTRY(volumeIncrease),
+    DY_STATS_ENTRY(volumeDecrease),
+    DY_STATS_ENTRY(interludeSpecified),
+    DY_STATS_ENTRY(interludeSpecifiedDevicePath),
+    DY_STATS_ENTRY(stopInterlude),
+    DY_STATS_ENTRY(setCycleMode),
+    DY_STATS_ENTRY(setCycleTimes),
+    DY_STATS_ENTRY(setEq),
+    DY_STATS_ENTRY(select),
+    DY_STATS_ENTRY(combinationPlay),
+    DY_STATS_ENTRY(endCombinationPlay),
+    DY_STATS_ENTRY(checksum),
+    DY_STATS_ENTRY(validateCrc),
+    DY_STATS_ENTRY(sendCommand_nocrc),
+    DY_STATS_ENTRY(sendCommand),
+    DY_STATS_ENTRY(getResponse),
+    DY_STATS_ENTRY(byPathCommand),
+};
 
+/******************************************************************************/
 
-/************************************INCLUDES***********************************/
-#include "DYPlayer.h"
+const uint8_t controlCommands[SIZEOF_COMMANDS][LENGTHOF_COMMANDS + LENGTHOF_CRC] = {
+    /************************************* control commands *********************************************/
+    /* PLAY_CMD                  :0  */ {COMMANDCODE, 0x02, 0x00, 0xAC}, /* play			                */
+    /* PAUSE_CMD	         :1  */{COMMANDCODE, 0x03, 0x00, 0xAD}, /* pause			                */
+    /* STOP_CMD	                 :2  */ {COMMANDCODE, 0x04, 0x00, 0xAE}, /* stop			                */
+    /* PREV_CMD			 :3  */{COMMANDCODE, 0x05, 0x00, 0xAF}, /* previous		                */
+    /* NEXT_CMD			 :4  */{COMMANDCODE, 0x06, 0x00, 0xB0}, /* next			                */
+    /* VOLUME_INC		 :5  */{COMMANDCODE, 0x14, 0x00, 0xBE}, /* volume +                             */
+    /* VOLUME_DEC		 :6  */{COMMANDCODE, 0x15, 0x00, 0xBF}, /* volume -                             */
+    /* PREV_FILE		 :7  */{COMMANDCODE, 0x0E, 0x00, 0xB8}, /* prev file		                */
+    /* NEXT_FILE		 :8  */{COMMANDCODE, 0x0F, 0x00, 0xB9}, /* next file                            */
+    /* STOP_PLAYING		 :9  */{COMMANDCODE, 0x10, 0x00, 0xBA}, /* stop playying	                */
+    /************************************* query commands ***********************************************/
+    /* QPLAY_CMD		 :10 */{COMMANDCODE, 0x01, 0x00, 0xAB}, /* Query play status				*/
+    /* QCURRENTDEV_CMD	 :11 */{COMMANDCODE, 0x09, 0x00, 0xB3},  /* Query current online device        */
+    /* QCURRENTPLAY_CMD	 :12 */ {COMMANDCODE, 0x0A, 0x00, 0xB4}, /* Query current play drive           */
+    /* QNUMBEROFSONG_CMD :13 */ {COMMANDCODE, 0x0C, 0x00, 0xB6}, /* Query number of songs			*/
+    /* QCURRENTSONG_CMD	 :14 */ {COMMANDCODE, 0x0D, 0x00, 0xB7}, /* Query current song				*/
+    /* QFOLDERDIR_CMD	 :15 */{COMMANDCODE, 0x11, 0x00, 0xBB},   /* Query folder dir song			*/
+    /* QFOLDERNUMBER_CMD :16 */ {COMMANDCODE, 0x12, 0x00, 0xBC}, /* Query folder # of song             */
+    /********************************** settings commands ***********************************************/
+    /* SETVOLUME_CMD     :17 */ {COMMANDCODE, 0x13, 0x01, RFU},         /* SetVolume                                          */
+    /* SETLOOPMODE_CMD   :18 */ {COMMANDCODE, 0x18, 0x01, RFU},         /* SetLoop Mode					*/
+    /* SETCYCTIMES_CMD   :19 */ {COMMANDCODE, 0x19, 0x02, RFU},         /* SetCycleTime H[3]:L[4]			*/
+    /* SETEQ_CMD                 :20 */ {COMMANDCODE, 0x1A, 0x01, RFU}, /* Set EQ							*/
+    /* SPECIFIEDSONG_CMD :21 */ {COMMANDCODE, 0x07, 0x02, RFU},         /* SpecifiedSong L[3]:D[4]:P[5]	*/
+    /* SPECIFIEDPATH_CMD :22 */ {COMMANDCODE, 0x08, RFU, RFU},          /* SpecifiedPath					*/
+    /* SWTICHDRIVE_CMD   :23 */ {COMMANDCODE, 0x0B, 0x01, RFU},         /* Switch Specified Drive			*/
+    /* SPECSONGINTER_CMD :24 */ {COMMANDCODE, 0x16, 0x03, RFU},         /* Specified song to be interplay	*/
+    /* SPECPATHINTER_CMD :25 */ {COMMANDCODE, 0x17, RFU, RFU},          /* Specified path to be interplay	*/
+    /* SLCTBUTNOPLAY_CMD :26 */ {COMMANDCODE, 0x1F, 0x02, RFU},         /* Select But no play				*/
+    /****************************************************************************************************/
+};
 
+/******************************************************************************/
+
+/* Instance of the `DYPlayer` calls, set by DYPlayer_Init() and DYPlayer_Use(). */
+static DYPlayer_t *dyPlayer = NULL;
+
+/******************************************************************************/
 
 /*******************************************************************************
-  @func    : serialWrite
-  @param   : uint8_t *buffer, uint8_t len
+  @func    : DYPlayer_Init
+  @param   : DYPlayer_t *player, const DYTransport_st *transport, void *ctx
   @return  : void
-  @date	   : 30.11.22
-  @brief   : Virtual method that should implement writing from the module via UART.
+  @date	   : 16.10.26
+  @brief   : Attach a transport to a driver instance and make it the one the
+             `DYPlayer` calls go to. The backend must be ready, i.e. its UART,
+             IRQs and DMA streams started, before the first call. Each module
+             gets its own instance and transport context.
 ********************************************************************************/
-void serialWrite(const uint8_t *buffer, uint8_t len) {
-    HAL_UART_Transmit(DYPLAYERUART, &buffer[0], len, 100);
+void DYPlayer_Init(DYPlayer_t *player, const DYTransport_st *transport, void *ctx) {
+    player->transport = transport;
+    player->ctx       = ctx;
+    DYParser_Init(&player->parser);
+    memset(&player->shadow, 0, sizeof(player->shadow));
+    player->suppress      = false;
+    player->savedCommands = 0;
+    player->savedBytes    = 0;
+    player->txFrames      = 0;
+    player->txBytes       = 0;
+    player->txDropped     = 0;
+    player->rxTimeouts    = 0;
+    player->busy          = NULL;
+    player->process       = NULL;
+    player->processCtx    = NULL;
+    dyPlayer              = player;
 }
 /*******************************************************************************
-  @func    : serialWrite_crc
-  @param   : uint8_t crc
+  @func    : DYPlayer_Use
+  @param   : DYPlayer_t *player
+  @return  : DYPlayer_t *
+  @date	   : 16.10.26
+  @brief   : Send the following `DYPlayer` calls to another initialised
+             instance. Returns the instance used so far, to switch back.
+             The DYPlayer_ calls don't look at it.
+********************************************************************************/
+DYPlayer_t *DYPlayer_Use(DYPlayer_t *player) {
+    DYPlayer_t *previous = dyPlayer;
+
+    dyPlayer = player;
+    return previous;
+}
+/*******************************************************************************
+  @func    : DYPlayer_Resync
+  @param   : DYPlayer_t *player
+  @return  : const DYShadow_t *
+  @date	   : 16.10.26
+  @brief   : Settings last sent to the module, read without touching the UART.
+             Check `known` before using a field.
+********************************************************************************/
+const DYShadow_t *DYPlayer_Shadow(const DYPlayer_t *player) {
+    return &player->shadow;
+}
+/*******************************************************************************
+  @func    : DYPlayer_Resync
+  @param   : DYPlayer_t *player
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Send every known setting again, e.g. after the module was reset
+             or powered up and fell back to its defaults.
+********************************************************************************/
+void DYPlayer_Resync(DYPlayer_t *player) {
+    DYShadow_t shadow   = player->shadow;
+    bool       suppress = player->suppress;
+
+    /* The module lost these settings, so they must go out even if unchanged. */
+    DY_STATS_ENTER();
+    player->suppress = false;
+    if (shadow.known & DY_SHADOW_DEVICE) DYPlayer_SetPlayingDevice(player, shadow.device);
+    if (shadow.known & DY_SHADOW_VOLUME) DYPlayer_SetVolume(player, shadow.volume);
+    if (shadow.known & DY_SHADOW_EQ)     DYPlayer_SetEq(player, shadow.eq);
+    if (shadow.known & DY_SHADOW_MODE)   DYPlayer_SetCycleMode(player, shadow.mode);
+    if (shadow.known & DY_SHADOW_CYCLES) DYPlayer_SetCycleTimes(player, shadow.cycles);
+    player->suppress = suppress;
+    DY_STATS_EXIT(DY_API_Resync);
+}
+/*******************************************************************************
+  @func    : DYPlayer_SetSuppression
+  @param   : DYPlayer_t *player, bool enable
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Drop setting, pause and stop commands the shadow state shows would
+             change nothing, e.g. setVolume() with the volume already set.
+             `savedCommands` and `savedBytes` count what was dropped.
+********************************************************************************/
+void DYPlayer_SetSuppression(DYPlayer_t *player, bool enable) {
+    player->suppress = enable;
+}
+/*******************************************************************************
+  @func    : DYPlayer_SetBusy
+  @param   : DYPlayer_t *player, const DYBusy_t *busy
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Answer checkPlayState() from the BUSY pin of the module instead
+             of a query, NULL to query again. BUSY can't tell paused from
+             stopped, the shadow state of the last pause() or stop() does.
+********************************************************************************/
+void DYPlayer_SetBusy(DYPlayer_t *player, const DYBusy_t *busy) {
+    player->busy = busy;
+}
+/*******************************************************************************
+  @func    : DYPlayer_Process
+  @param   : DYPlayer_t *player, uint32_t now
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Cooperative tick of an instance, never waits: runs its DYAsync_t
+             queue (TX, answers, timeouts, retries, callbacks) at `now`, the
+             transport time. Without a queue the bytes received so far go to
+             the parser handlers. Call it often from one context, a superloop,
+             a scheduler tick or an RTOS task, instead of the blocking calls.
+********************************************************************************/
+void DYPlayer_Process(DYPlayer_t *player, uint32_t now) {
+    if (player->process != NULL) {
+        player->process(player->processCtx, now);
+        return;
+    }
+
+    uint8_t  buf[DY_FRAME_MAX];
+    uint16_t n;
+
+    while ((n = player->transport->read(player->ctx, &buf[0], sizeof(buf), 0)) > 0) {
+        DYParser_FeedBlock(&player->parser, &buf[0], n);
+    }
+}
+/*******************************************************************************
+  @func    : redundant
+  @param   : DYPlayer_t *player, uint8_t field, bool same, uint8_t bytes
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : True if suppression is on and the `field` of the shadow is known
+             and `same` as requested; the `bytes` of the dropped frame are
+             counted as saved.
+********************************************************************************/
+static bool redundant(DYPlayer_t *player, uint8_t field, bool same, uint8_t bytes) {
+    if (!player->suppress || !(player->shadow.known & field) || !same) {
+        return false;
+    }
+    player->savedCommands++;
+    player->savedBytes += bytes;
+    return true;
+}
+/*******************************************************************************
+  @func    : keepsPlayState
+  @param   : uint8_t opcode
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Queries and sound settings, the commands that leave the play state
+             as it is.
+********************************************************************************/
+static bool keepsPlayState(uint8_t opcode) {
+    switch (opcode) {
+        case 0x01: case 0x09: case 0x0A: case 0x0C: case 0x0D: case 0x11: case 0x12:
+        case 0x13: case 0x14: case 0x15: case 0x18: case 0x19: case 0x1A:
+            return true;
+        default:
+            return false;
+    }
+}
+/*******************************************************************************
+  @func    : DYShadow_Record
+  @param   : DYShadow_t *shadow, const uint8_t *frame
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Record a complete frame that went out other than through the
+             setters, e.g. from a queue or a batch, in a shadow state.
+********************************************************************************/
+void DYShadow_Record(DYShadow_t *shadow, const uint8_t *frame) {
+    const uint8_t *data = &frame[3];
+
+    switch (frame[CMD_OPCODE_INDEX]) {
+        case 0x03:
+            shadow->state  = Paused;
+            shadow->known |= DY_SHADOW_STATE;
+            break;
+        case 0x04:
+            shadow->state  = Stopped;
+            shadow->known |= DY_SHADOW_STATE;
+            break;
+        case 0x0B:
+            shadow->device = (device_t)data[0];
+            shadow->known |= DY_SHADOW_DEVICE;
+            shadow->known &= ~DY_SHADOW_STATE;
+            break;
+        case 0x13:
+            shadow->volume = (data[0] > DY_VOLUME_MAX) ? DY_VOLUME_MAX : data[0];
+            shadow->known |= DY_SHADOW_VOLUME;
+            break;
+        case 0x14:
+            if (shadow->volume < DY_VOLUME_MAX) shadow->volume++;
+            break;
+        case 0x15:
+            if (shadow->volume > 0) shadow->volume--;
+            break;
+        case 0x18:
+            shadow->mode   = (play_mode_t)data[0];
+            shadow->known |= DY_SHADOW_MODE;
+            break;
+        case 0x19:
+            shadow->cycles = (data[0] << 8) | data[1];
+            shadow->known |= DY_SHADOW_CYCLES;
+            break;
+        case 0x1A:
+            shadow->eq     = (eq_t)data[0];
+            shadow->known |= DY_SHADOW_EQ;
+            break;
+        default:
+            if (!keepsPlayState(frame[CMD_OPCODE_INDEX])) {
+                shadow->known &= ~DY_SHADOW_STATE;
+            }
+            break;
+    }
+}
+/*******************************************************************************
+  @func    : DYPlayer_Write
+  @param   : DYPlayer_t *player, const uint8_t *buffer, uint8_t len
   @return  : void
   @date	   : 30.11.22
-  @brief   : Map writing a single byte to the same method as writing a buffer of
-             length 1. That buffer has crc value
+  @brief   : Hand a frame to the transport. Queueing backends only make this
+             wait while they are full, the frame is dropped if no room shows
+             up within DY_TX_TIMEOUT.
 ********************************************************************************/
-void serialWrite_crc(uint8_t crc) {
-    uint8_t buf[1];
-    buf[0] = crc;
+void DYPlayer_Write(DYPlayer_t *player, const uint8_t *buffer, uint8_t len) {
+    const DYTransport_st *io    = player->transport;
+    uint32_t              start = io->now(player->ctx);
+    uint8_t               sent  = 0;
 
-    HAL_UART_Transmit(DYPLAYERUART, &buf[0], 1, 100);
+    if ((len > CMD_OPCODE_INDEX) && (buffer[0] == COMMANDCODE) && !keepsPlayState(buffer[CMD_OPCODE_INDEX])) {
+        player->shadow.known &= ~DY_SHADOW_STATE;
+    }
+
+    while (sent < len) {
+        uint16_t n = DY_STATS_IO(io->write(player->ctx, &buffer[sent], len - sent));
+        if (n == 0) {
+            if ((io->now(player->ctx) - start) >= (DY_TX_TIMEOUT * 1000U)) {
+                player->txDropped++;
+                return;
+            }
+            DY_STATS_IO_VOID(io->wait(player->ctx, DY_TX_RETRY));
+        }
+        sent += n;
+    }
+    player->txFrames++;
+    player->txBytes += len;
 }
 /*******************************************************************************
-  @func    : serialRead
-  @param   : uint8_t *buffer, uint8_t len
+  @func    : DYPlayer_Read
+  @param   : DYPlayer_t *player, uint8_t *buffer, uint8_t len
   @return  : uint8_t
   @date	   : 30.11.22
-  @brief   : Virtual method that should implement reading from the module via UART.
+  @brief   : Read from the module through the transport.
+             Returns the number of bytes actually read, less than `len` on
+             timeout.
 ********************************************************************************/
-uint8_t serialRead(uint8_t *buffer, uint8_t len) {
-    HAL_UART_Receive(DYPLAYERUART, &buffer[0], len, 100);
-
-    return true;
+uint8_t DYPlayer_Read(DYPlayer_t *player, uint8_t *buffer, uint8_t len) {
+    return DY_STATS_IO(player->transport->read(player->ctx, &buffer[0], len, DY_RX_TIMEOUT * 1000U));
 }
 /*******************************************************************************
   @func    : checksum
@@ -77,47 +379,65 @@ bool validateCrc(uint8_t *data, uint8_t len) {
     return checksum(data, len - 1) == crc;
 }
 /*******************************************************************************
-  @func    : sendCommand_nocrc
-  @param   : void
-  @return  : uint8_t *data, uint8_t len
-  @date	   : 30.11.22
-  @brief   : Send a command to the module, adds a CRC to the passed buffer.
+  @func    : sendControl
+  @param   : DYPlayer_t *player, uint8_t index
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Send a fixed row of controlCommands[], SM included, in one write
+             straight from flash.
 ********************************************************************************/
-void sendCommand_nocrc(uint8_t *data, uint8_t len) {
-    uint8_t crc = checksum(data, len);
-    serialWrite(data, len);
-    serialWrite_crc(crc);
+static void sendControl(DYPlayer_t *player, uint8_t index) {
+    DYPlayer_Write(player, &controlCommands[index][0], LENGTHOF_COMMANDS + LENGTHOF_CRC);
 }
 /*******************************************************************************
-  @func    : sendCommand
-  @param   : uint8_t *data, uint8_t len, uint8_t crc
+  @func    : sendFrame
+  @param   : DYPlayer_t *player, DYFrame_t *frame
   @return  : void
-  @date	   : 30.11.22
-  @brief   : data pointer to bytes to send to the module.
+  @date	   : 16.10.26
+  @brief   : Close a built frame and send it in one write. Frames that did not
+             fit into DY_FRAME_MAX are dropped.
 ********************************************************************************/
-void sendCommand(const uint8_t *data, uint8_t len, uint8_t crc) {
-    serialWrite(data, len);
-    serialWrite_crc(crc);
+static void sendFrame(DYPlayer_t *player, DYFrame_t *frame) {
+    uint8_t len = DYFrame_End(frame);
+    if (len > 0) {
+        DYPlayer_Write(player, &frame->data[0], len);
+    }
 }
 /*******************************************************************************
-  @func    : getResponse
-  @param   : uint8_t *buffer, uint8_t len
+  @func    : DYPlayer_GetResponse
+  @param   : DYPlayer_t *player, uint8_t *buffer, uint8_t len, uint8_t opcode
   @return  : bool
   @date	   : 30.11.22
   @brief   : Get a response to a command.
-             Reads data from UART, validates the CRC, and puts it in the buffer.
+             Feeds received bytes to the parser until a frame of `len` bytes
+             with a valid CRC and the answer `opcode` is complete, and puts it
+             in the buffer. Noise and broken frames in front of it are skipped,
+             other valid frames (a late answer to a query that timed out) go
+             to their parser handler and are not taken as this answer.
 ********************************************************************************/
-bool getResponse(uint8_t *buffer, uint8_t len) {
-    if (serialRead(buffer, len) > 0) {
-        if (DYPlayer.validateCrc(buffer, len)) {
+bool DYPlayer_GetResponse(DYPlayer_t *player, uint8_t *buffer, uint8_t len, uint8_t opcode) {
+    const DYTransport_st *io      = player->transport;
+    DYParser_t           *parser  = &player->parser;
+    uint32_t              timeout = DY_RX_TIMEOUT * 1000U;
+    uint32_t              start   = io->now(player->ctx);
+    uint8_t               byte;
+
+    for (;;) {
+        uint32_t elapsed = io->now(player->ctx) - start;
+        if ((elapsed >= timeout) || (DY_STATS_IO(io->read(player->ctx, &byte, 1, timeout - elapsed)) == 0)) {
+            player->rxTimeouts++;
+            return false;
+        }
+        if (DYParser_Feed(parser, byte) && (parser->len == len) &&
+            (parser->frame[CMD_OPCODE_INDEX] == opcode)) {
+            memcpy(buffer, &parser->frame[0], len);
             return true;
         }
     }
-    return false;
 }
 /*******************************************************************************
-  @func    : byPathCommand
-  @param   : uint8_t command, device_t device, char *path
+  @func    : byPath
+  @param   : DYPlayer_t *player, uint8_t command, device_t device, char *path
   @return  : void
   @date	   : 30.11.22
   @brief   : Send command with converted paths to  weird format required by the
@@ -130,289 +450,266 @@ bool getResponse(uint8_t *buffer, uint8_t len) {
              NOTE: This comment uses a unicode * look-a-alike (﹡) because ﹡/ end the
              comment.
 ********************************************************************************/
-void byPathCommand(uint8_t command, device_t device, char *path) {
-    uint8_t len = strlen(path);
-    if (len < 1) return;
-    uint8_t _len = len;
-    // Count / in path and, except root slash and determine new length
-    for (uint8_t i = 1; i < len; i++) {
-        if (path[i] == '/')
-            _len++;
-    }
-    #ifdef DY_PATHS_IN_HEAP
-    uint8_t *_command = new uint8_t[_len + 4];
-    #else
-    uint8_t _command[DY_PATH_LEN + 4];
-    #endif
-
-    _command[0] = 0xaa;
-    _command[1] = command;
-    _command[2] = _len + 1;
-    _command[3] = (uint8_t)device;
-    _command[4] = path[0];
-    uint8_t j = 5;
-    for (uint8_t i = 1; i < len; i++) {
-        switch (path[i]) {
-            case '.':
-                _command[j] = '*';
-                break;
-            case '/':
-                _command[j] = '*';
-                j++;
-            // fall-through
-            default:
-                _command[j] = toupper(path[i]);
-        }
-        j++;
-    }
-    sendCommand_nocrc(_command, len + 4);
-    #ifdef DY_PATHS_IN_HEAP
-    delete[] _command;
-    #endif
+static void byPath(DYPlayer_t *player, uint8_t command, device_t device, char *path) {
+    if (strlen(path) < 1) return;
+
+    DYFrame_t frame;
+
+    DYFrame_Begin(&frame, command);
+    DYFrame_PutByte(&frame, (uint8_t)device);
+    DYFrame_PutPath(&frame, path);
+    sendFrame(player, &frame);
 }
 /*******************************************************************************
-  @func    : checkPlayState
-  @param   : void
+  @func    : DYPlayer_CheckPlayState
+  @param   : DYPlayer_t *player
   @return  : play_state_t
   @date	   : 30.11.22
   @brief   : Check the current play state can, be called at any time.
 ********************************************************************************/
-play_state_t checkPlayState(void) {
+play_state_t DYPlayer_CheckPlayState(DYPlayer_t *player) {
     /*
     uint8_t command[3] = { 0xaa, 0x01, 0x00 };
      sendCommand(command, 3, 0xab);
     */
 
-    sendCommand(&controlCommands[QPLAY_CMD][0],
-                LENGTHOF_COMMANDS,
-                controlCommands[QPLAY_CMD][CMD_CRC_INDEX]);
+    if (player->busy != NULL) {
+        if (DYBusy_Playing(player->busy)) {
+            player->shadow.state  = Playing;
+            player->shadow.known |= DY_SHADOW_STATE;
+            return Playing;
+        }
+        if ((player->shadow.known & DY_SHADOW_STATE) && (player->shadow.state == Paused)) {
+            return Paused;
+        }
+        return Stopped;
+    }
 
-    uint8_t buffer[6];
-    if (DYPlayer.getResponse(buffer, 6)) {
+    sendControl(player, QPLAY_CMD);
+
+    uint8_t buffer[5];
+    if (DYPlayer_GetResponse(player, buffer, 5, controlCommands[QPLAY_CMD][CMD_OPCODE_INDEX])) {
+        player->shadow.state  = (play_state_t)buffer[3];
+        player->shadow.known |= DY_SHADOW_STATE;
         return (play_state_t)buffer[3];
     }
     // return (play_state_t) PlayState.Fail;
     return Fail;   // Fudge
 }
 /*******************************************************************************
-  @func    : play
-  @param   : void
+  @func    : DYPlayer_Play
+  @param   : DYPlayer_t *player
   @return  : void
   @date	   : 30.11.22
   @brief   : Play the currently selected file from the start.
 ********************************************************************************/
-void play(void) {
+void DYPlayer_Play(DYPlayer_t *player) {
     /*
     uint8_t command[3] = {0xaa, 0x02, 0x00};
     */
 
-    sendCommand(&controlCommands[PLAY_CMD][0],
-                LENGTHOF_COMMANDS,
-                controlCommands[PLAY_CMD][CMD_CRC_INDEX]);
+    sendControl(player, PLAY_CMD);
 }
 /*******************************************************************************
-  @func    : pause
-  @param   : void
+  @func    : DYPlayer_Pause
+  @param   : DYPlayer_t *player
   @return  : void
   @date	   : 30.11.22
   @brief   : Set the play state to paused.
 ********************************************************************************/
-void pause() {
+void DYPlayer_Pause(DYPlayer_t *player) {
     /*
     uint8_t command[3] = {0xaa, 0x03, 0x00};
     */
 
-    sendCommand(&controlCommands[PAUSE_CMD][0],
-                LENGTHOF_COMMANDS,
-                controlCommands[PAUSE_CMD][CMD_CRC_INDEX]);
+    if (redundant(player, DY_SHADOW_STATE, (player->shadow.state == Paused),
+                  DY_FRAME_OVERHEAD)) return;
+
+    sendControl(player, PAUSE_CMD);
+
+    player->shadow.state  = Paused;
+    player->shadow.known |= DY_SHADOW_STATE;
 }
 /*******************************************************************************
-  @func    : stop
-  @param   : void
+  @func    : DYPlayer_Stop
+  @param   : DYPlayer_t *player
   @return  : void
   @date	   : 30.11.22
   @brief   : Set the play state to stopped.
 ********************************************************************************/
-void stop() {
+void DYPlayer_Stop(DYPlayer_t *player) {
     /*
     uint8_t command[3] = {0xaa, 0x04, 0x00};
     */
 
-    sendCommand(&controlCommands[STOP_CMD][0],
-                LENGTHOF_COMMANDS,
-                controlCommands[STOP_CMD][CMD_CRC_INDEX]);
+    if (redundant(player, DY_SHADOW_STATE, (player->shadow.state == Stopped),
+                  DY_FRAME_OVERHEAD)) return;
+
+    sendControl(player, STOP_CMD);
+
+    player->shadow.state  = Stopped;
+    player->shadow.known |= DY_SHADOW_STATE;
 }
 /*******************************************************************************
-  @func    : previous
-  @param   : void
+  @func    : DYPlayer_Previous
+  @param   : DYPlayer_t *player
   @return  : void
   @date	   : 30.11.22
   @brief   : Play the previous file.
 ********************************************************************************/
-void previous() {
+void DYPlayer_Previous(DYPlayer_t *player) {
     /*
     uint8_t command[3] = {0xaa, 0x05, 0x00};
     */
-    sendCommand(&controlCommands[PREV_CMD][0],
-                LENGTHOF_COMMANDS,
-                controlCommands[PREV_CMD][CMD_CRC_INDEX]);
+    sendControl(player, PREV_CMD);
 }
 /*******************************************************************************
-  @func    : next
-  @param   : void
+  @func    : DYPlayer_Next
+  @param   : DYPlayer_t *player
   @return  : void
   @date	   : 30.11.22
   @brief   : Play the next file.
 ********************************************************************************/
-void next() {
+void DYPlayer_Next(DYPlayer_t *player) {
     /*
     uint8_t command[3] = {0xaa, 0x06, 0x00};
     */
 
-    sendCommand(&controlCommands[PREV_CMD][0],
-                LENGTHOF_COMMANDS,
-                controlCommands[PREV_CMD][CMD_CRC_INDEX]);
+    sendControl(player, NEXT_CMD);
 }
 /*******************************************************************************
-  @func    : playSpecified
-  @param   : void
+  @func    : DYPlayer_PlaySpecified
+  @param   : DYPlayer_t *player, uint16_t number
   @return  : void
   @date	   : 30.11.22
   @brief   :
 ********************************************************************************/
-void playSpecified(uint16_t number) {
+void DYPlayer_PlaySpecified(DYPlayer_t *player, uint16_t number) {
     /*
     uint8_t command[5] = { 0xaa, 0x07, 0x02, 0x00, 0x00 };
     */
-    uint8_t command[5] = {0};
-
-    memcpy(&command[0],
-           &controlCommands[SPECIFIEDSONG_CMD][0],
-           LENGTHOF_COMMANDS);
+    DYFrame_t frame;
 
-    command[3] = number >> 8;
-    command[4] = number & 0xff;
-    sendCommand_nocrc(command, 5);
+    DYFrame_Begin(&frame, controlCommands[SPECIFIEDSONG_CMD][CMD_OPCODE_INDEX]);
+    DYFrame_PutWord(&frame, number);
+    sendFrame(player, &frame);
 }
 /*******************************************************************************
-  @func    : playSpecifiedDevicePath
-  @param   : device_t device, char *path
+  @func    : DYPlayer_PlaySpecifiedDevicePath
+  @param   : DYPlayer_t *player, device_t device, char *path
   @return  : void
   @date	   : 30.11.22
   @brief   : Play a sound file by number, number sent as 2 bytes.
 ********************************************************************************/
-void playSpecifiedDevicePath(device_t device, char *path) {
-    DYPlayer.byPathCommand(0x08, device, path);
+void DYPlayer_PlaySpecifiedDevicePath(DYPlayer_t *player, device_t device, char *path) {
+    byPath(player, 0x08, device, path);
 }
 /*******************************************************************************
-  @func    : setPlayingDevice
-  @param   : void
+  @func    : DYPlayer_GetPlayingDevice
+  @param   : DYPlayer_t *player
   @return  : device_t
   @date	   : 30.11.22
   @brief   : Get the storage device that is currently used for playing sound files.
 ********************************************************************************/
-device_t getPlayingDevice(void) {
+device_t DYPlayer_GetPlayingDevice(DYPlayer_t *player) {
     /*
       uint8_t command[3] = { 0xaa, 0x0a, 0x00 };
       sendCommand(command, 3, 0xb4);
     */
 
-    sendCommand(&controlCommands[QCURRENTPLAY_CMD][0],
-                LENGTHOF_COMMANDS,
-                controlCommands[QCURRENTPLAY_CMD][CMD_CRC_INDEX]);
+    sendControl(player, QCURRENTPLAY_CMD);
 
     uint8_t buffer[5];
-    if (DYPlayer.getResponse(buffer, 5)) {
+    if (DYPlayer_GetResponse(player, buffer, 5, controlCommands[QCURRENTPLAY_CMD][CMD_OPCODE_INDEX])) {
+        player->shadow.device = (device_t)buffer[3];
+        player->shadow.known |= DY_SHADOW_DEVICE;
         return (device_t)buffer[3];
     }
     return Failed;
 }
 /*******************************************************************************
-  @func    : getPlayingDevice
-  @param   : device_t device
+  @func    : DYPlayer_SetPlayingDevice
+  @param   : DYPlayer_t *player, device_t device
   @return  : void
   @date	   : 30.11.22
   @brief   : Set the device number the module should use.
              Tries to set the device but no guarantee is given, use `getDevice()`
              to check the actual current storage device.
 ********************************************************************************/
-void setPlayingDevice(device_t device) {
+void DYPlayer_SetPlayingDevice(DYPlayer_t *player, device_t device) {
     /*
     uint8_t command[4] = { 0xaa, 0x0b, 0x01, 0x00 };
     */
 
-    uint8_t command[4] = {0};
+    if (redundant(player, DY_SHADOW_DEVICE, (player->shadow.device == device),
+                  DY_FRAME_OVERHEAD + 1)) return;
 
-    memcpy(&command[0],
-           &controlCommands[SWTICHDRIVE_CMD][0],
-           LENGTHOF_COMMANDS);
+    DYFrame_t frame;
 
-    command[3] = (uint8_t)device;
-    sendCommand_nocrc(command, 4);
+    DYFrame_Begin(&frame, controlCommands[SWTICHDRIVE_CMD][CMD_OPCODE_INDEX]);
+    DYFrame_PutByte(&frame, (uint8_t)device);
+    sendFrame(player, &frame);
+
+    player->shadow.device = device;
+    player->shadow.known |= DY_SHADOW_DEVICE;
 }
 /*******************************************************************************
-  @func    : getSoundCount
-  @param   : void
+  @func    : DYPlayer_GetSoundCount
+  @param   : DYPlayer_t *player
   @return  : uint16_t
   @date	   : 30.11.22
   @brief   : Get the amount of sound files on the current storage device.
 ********************************************************************************/
-uint16_t getSoundCount(void) {
+uint16_t DYPlayer_GetSoundCount(DYPlayer_t *player) {
     /*
       uint8_t command[3] = { 0xaa, 0x0c, 0x00 };
       sendCommand(command, 3, 0xb6);
     */
 
-    sendCommand(&controlCommands[QNUMBEROFSONG_CMD][0],
-                LENGTHOF_COMMANDS,
-                controlCommands[QNUMBEROFSONG_CMD][CMD_CRC_INDEX]);
+    sendControl(player, QNUMBEROFSONG_CMD);
 
     uint8_t buffer[6];
-    if (DYPlayer.getResponse(buffer, 6)) {
+    if (DYPlayer_GetResponse(player, buffer, 6, controlCommands[QNUMBEROFSONG_CMD][CMD_OPCODE_INDEX])) {
         return (buffer[3] << 8) | buffer[4];
     }
     return 0;
 }
 /*******************************************************************************
-  @func    : getPlayingSound
-  @param   : void
+  @func    : DYPlayer_GetPlayingSound
+  @param   : DYPlayer_t *player
   @return  : uint16_t
   @date	   : 30.11.22
   @brief   : Get the currently playing file by number.
 ********************************************************************************/
-uint16_t getPlayingSound(void) {
+uint16_t DYPlayer_GetPlayingSound(DYPlayer_t *player) {
     /*
       uint8_t command[3] = { 0xaa, 0x0d, 0x00 };
       sendCommand(command, 3, 0xb7);
     */
 
-    sendCommand(&controlCommands[QCURRENTSONG_CMD][0],
-                LENGTHOF_COMMANDS,
-                controlCommands[QCURRENTSONG_CMD][CMD_CRC_INDEX]);
+    sendControl(player, QCURRENTSONG_CMD);
 
     uint8_t buffer[6];
-    if (DYPlayer.getResponse(buffer, 6)) {
+    if (DYPlayer_GetResponse(player, buffer, 6, controlCommands[QCURRENTSONG_CMD][CMD_OPCODE_INDEX])) {
         return (buffer[3] << 8) | buffer[4];
     }
     return 0;
 }
 /*******************************************************************************
-  @func    : previousDir
-  @param   : playDirSound_t song
+  @func    : DYPlayer_PreviousDir
+  @param   : DYPlayer_t *player, playDirSound_t song
   @return  : void
   @date	   : 30.11.22
   @brief   : Select previous directory and start playing the first or last song.
 ********************************************************************************/
-void previousDir(playDirSound_t song) {
+void DYPlayer_PreviousDir(DYPlayer_t *player, playDirSound_t song) {
     if (song == LastSound)
     {
         /*
         uint8_t command[3] = { 0xaa, 0x0e, 0x00 };
         sendCommand(command, 3, 0xb8);
         */
-        sendCommand(&controlCommands[PREV_FILE][0],
-                    LENGTHOF_COMMANDS,
-                    controlCommands[PREV_FILE][CMD_CRC_INDEX]);
+        sendControl(player, PREV_FILE);
     }
     else   /* FirstSound */
     {
@@ -420,115 +717,226 @@ void previousDir(playDirSound_t song) {
         uint8_t command[3] = { 0xaa, 0x0f, 0x00 };
         sendCommand(command, 3, 0xb9);
         */
-        sendCommand(&controlCommands[NEXT_FILE][0],
-                    LENGTHOF_COMMANDS,
-                    controlCommands[NEXT_FILE][CMD_CRC_INDEX]);
+        sendControl(player, NEXT_FILE);
     }
 }
 /*******************************************************************************
-  @func    : getFirstInDir
-  @param   : void
+  @func    : DYPlayer_GetFirstInDir
+  @param   : DYPlayer_t *player
   @return  : uint16_t
   @date	   : 30.11.22
   @brief   : Get number of the first song in the currently selected directory.
 ********************************************************************************/
-uint16_t getFirstInDir(void) {
+uint16_t DYPlayer_GetFirstInDir(DYPlayer_t *player) {
     /*
     uint8_t command[3] = { 0xaa, 0x11, 0x00 };
     sendCommand(command, 3, 0xbb);
     */
 
-    sendCommand(&controlCommands[QFOLDERDIR_CMD][0],
-                LENGTHOF_COMMANDS,
-                controlCommands[QFOLDERDIR_CMD][CMD_CRC_INDEX]);
+    sendControl(player, QFOLDERDIR_CMD);
 
     uint8_t buffer[6];
-    if (DYPlayer.getResponse(buffer, 6)) {
+    if (DYPlayer_GetResponse(player, buffer, 6, controlCommands[QFOLDERDIR_CMD][CMD_OPCODE_INDEX])) {
         return (buffer[3] << 8) | buffer[4];
     }
     return 0;
 }
 /*******************************************************************************
-  @func    : getSoundCountDir
-  @param   : void
+  @func    : DYPlayer_GetSoundCountDir
+  @param   : DYPlayer_t *player
   @return  : uint16_t
   @date	   : 30.11.22
   @brief   : Get the amount of sound files in the currently selected directory.
 ********************************************************************************/
-uint16_t getSoundCountDir(void) {
+uint16_t DYPlayer_GetSoundCountDir(DYPlayer_t *player) {
     /*
     uint8_t command[3] = { 0xaa, 0x12, 0x00 };
     sendCommand(command, 3, 0xbc);
     */
 
-    sendCommand(&controlCommands[QFOLDERNUMBER_CMD][0],
-                LENGTHOF_COMMANDS,
-                controlCommands[QFOLDERNUMBER_CMD][CMD_CRC_INDEX]);
+    sendControl(player, QFOLDERNUMBER_CMD);
 
     uint8_t buffer[6];
-    if (DYPlayer.getResponse(buffer, 6)) {
+    if (DYPlayer_GetResponse(player, buffer, 6, controlCommands[QFOLDERNUMBER_CMD][CMD_OPCODE_INDEX])) {
         return (buffer[3] << 8) | buffer[4];
     }
     return 0;
 }
 /*******************************************************************************
-  @func    : setVolume
-  @param   : uint8_t volume
+  @func    : snapshotField
+  @param   : DYStatus_t *status, const uint8_t *frame
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Put one query answer into its status field.
+********************************************************************************/
+static void snapshotField(DYStatus_t *status, const uint8_t *frame) {
+    uint16_t word = (frame[3] << 8) | frame[4];
+
+    switch (frame[CMD_OPCODE_INDEX]) {
+        case 0x01:
+            status->state = (play_state_t)frame[3];
+            status->valid |= DY_STATUS_STATE;
+            break;
+        case 0x0A:
+            status->device = (device_t)frame[3];
+            status->valid |= DY_STATUS_DEVICE;
+            break;
+        case 0x0D:
+            status->sound = word;
+            status->valid |= DY_STATUS_SOUND;
+            break;
+        case 0x0C:
+            status->soundCount = word;
+            status->valid |= DY_STATUS_SOUNDCOUNT;
+            break;
+        case 0x11:
+            status->firstInDir = word;
+            status->valid |= DY_STATUS_FIRSTINDIR;
+            break;
+        case 0x12:
+            status->soundCountDir = word;
+            status->valid |= DY_STATUS_SOUNDCOUNTDIR;
+            break;
+        default:
+            break;
+    }
+}
+/*******************************************************************************
+  @func    : snapshot
+  @param   : DYPlayer_t *player, DYStatus_t *status
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Ask the six status queries in one write and collect the answers
+             as they come, matched by opcode.
+********************************************************************************/
+static void snapshot(DYPlayer_t *player, DYStatus_t *status) {
+    static const uint8_t queries[] = {
+        QPLAY_CMD, QCURRENTPLAY_CMD, QCURRENTSONG_CMD,
+        QNUMBEROFSONG_CMD, QFOLDERDIR_CMD, QFOLDERNUMBER_CMD
+    };
+    uint8_t burst[sizeof(queries) * (LENGTHOF_COMMANDS + LENGTHOF_CRC)];
+    uint8_t byte;
+
+    const DYTransport_st *io     = player->transport;
+    DYParser_t           *parser = &player->parser;
+    uint32_t              start  = io->now(player->ctx);
+
+    for (uint8_t i = 0; i < sizeof(queries); i++) {
+        memcpy(&burst[i * (LENGTHOF_COMMANDS + LENGTHOF_CRC)], &controlCommands[queries[i]][0],
+               LENGTHOF_COMMANDS + LENGTHOF_CRC);
+    }
+    DYParser_Reset(parser);
+    DYPlayer_Write(player, &burst[0], sizeof(burst));
+
+    uint32_t sent    = io->now(player->ctx);
+    uint32_t timeout = DY_RX_TIMEOUT * 1000U;
+
+    while (status->valid != DY_STATUS_ALL) {
+        uint32_t elapsed = io->now(player->ctx) - sent;
+        if ((elapsed >= timeout) || (DY_STATS_IO(io->read(player->ctx, &byte, 1, timeout - elapsed)) == 0)) {
+            break;
+        }
+        if (DYParser_Feed(parser, byte)) {
+            snapshotField(status, &parser->frame[0]);
+        }
+    }
+
+    if (status->valid != DY_STATUS_ALL) {
+        player->rxTimeouts++;
+    }
+    status->elapsedUs = io->now(player->ctx) - start;
+}
+/*******************************************************************************
+  @func    : DYPlayer_Snapshot
+  @param   : DYPlayer_t *player, DYStatus_t *status
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Read every status field of the module in one burst: the six
+             queries leave in one write and get a single DY_RX_TIMEOUT after
+             it, instead of one per getter. Returns true when every field is
+             valid.
+********************************************************************************/
+bool DYPlayer_Snapshot(DYPlayer_t *player, DYStatus_t *status) {
+    DY_STATS_ENTER();
+    memset(status, 0, sizeof(*status));
+    status->state  = Fail;
+    status->device = Failed;
+    snapshot(player, status);
+    DY_STATS_EXIT(DY_API_Snapshot);
+
+    return status->valid == DY_STATUS_ALL;
+}
+/*******************************************************************************
+  @func    : DYPlayer_SetVolume
+  @param   : DYPlayer_t *player, uint8_t volume
   @return  : void
   @date	   : 30.11.22
   @brief   : Set the playback volume between 0 and 30.
              Default volume if not set: 20.
 ********************************************************************************/
-void setVolume(uint8_t volume) {
+void DYPlayer_SetVolume(DYPlayer_t *player, uint8_t volume) {
     /*
     uint8_t command[4] = { 0xaa, 0x13, 0x01, 0x00 };
     */
 
-    uint8_t command[4] = {0};
+    if (redundant(player, DY_SHADOW_VOLUME, (player->shadow.volume == volume),
+                  DY_FRAME_OVERHEAD + 1)) return;
 
-    memcpy(&command[0],
-           &controlCommands[SETVOLUME_CMD][0],
-           LENGTHOF_COMMANDS);
+    DYFrame_t frame;
 
-    command[3] = volume;
-    sendCommand_nocrc(command, 4);
+    DYFrame_Begin(&frame, controlCommands[SETVOLUME_CMD][CMD_OPCODE_INDEX]);
+    DYFrame_PutByte(&frame, volume);
+    sendFrame(player, &frame);
+
+    player->shadow.volume = (volume > DY_VOLUME_MAX) ? DY_VOLUME_MAX : volume;
+    player->shadow.known |= DY_SHADOW_VOLUME;
 }
 /*******************************************************************************
-  @func    : volumeIncrease
-  @param   : void
+  @func    : DYPlayer_VolumeIncrease
+  @param   : DYPlayer_t *player
   @return  : void
   @date	   : 30.11.22
   @brief   : Increase the volume.
 ********************************************************************************/
-void volumeIncrease(void) {
+void DYPlayer_VolumeIncrease(DYPlayer_t *player) {
     /*
     uint8_t command[3] = {0xaa, 0x14, 0x00};
     sendCommand(command, 3, 0xbe);
     */
-    sendCommand(&controlCommands[VOLUME_INC][0],
-                LENGTHOF_COMMANDS,
-                controlCommands[VOLUME_INC][CMD_CRC_INDEX]);
+    if (redundant(player, DY_SHADOW_VOLUME, (player->shadow.volume >= DY_VOLUME_MAX),
+                  DY_FRAME_OVERHEAD)) return;
+
+    sendControl(player, VOLUME_INC);
+
+    if (player->shadow.volume < DY_VOLUME_MAX) {
+        player->shadow.volume++;
+    }
 }
 /*******************************************************************************
-  @func    : volumeDecrease
-  @param   : void
+  @func    : DYPlayer_VolumeDecrease
+  @param   : DYPlayer_t *player
   @return  : void
   @date	   : 30.11.22
   @brief   : Decrease the volume.
 ********************************************************************************/
-void volumeDecrease(void) {
+void DYPlayer_VolumeDecrease(DYPlayer_t *player) {
     /*
     uint8_t command[3] = {0xaa, 0x15, 0x00};
     sendCommand(command, 3, 0xbf);
     */
 
-    sendCommand(&controlCommands[VOLUME_DEC][0],
-                LENGTHOF_COMMANDS,
-                controlCommands[VOLUME_DEC][CMD_CRC_INDEX]);
+    if (redundant(player, DY_SHADOW_VOLUME, (player->shadow.volume == 0),
+                  DY_FRAME_OVERHEAD)) return;
+
+    sendControl(player, VOLUME_DEC);
+
+    if (player->shadow.volume > 0) {
+        player->shadow.volume--;
+    }
 }
 /*******************************************************************************
-  @func    : interludeSpecified
-  @param   : device_t device, uint16_t number
+  @func    : DYPlayer_InterludeSpecified
+  @param   : DYPlayer_t *player, device_t device, uint16_t number
   @return  : void
   @date	   : 30.11.22
   @brief   : Play an interlude file by device and number, number sent as 2 bytes.
@@ -537,17 +945,17 @@ void volumeDecrease(void) {
              played immediately). When the interlude is finished, it will return to
              the first interlude breakpoint and continue to play.
 ********************************************************************************/
-void interludeSpecified(device_t device, uint16_t number) {
-    uint8_t command[6] = {0xaa, 0x0b, 0x03, 0x00, 0x00, 0x00};
+void DYPlayer_InterludeSpecified(DYPlayer_t *player, device_t device, uint16_t number) {
+    DYFrame_t frame;
 
-    command[3] = (uint8_t)device;
-    command[4] = number >> 8;
-    command[5] = number & 0xff;
-    sendCommand_nocrc(command, 6);
+    DYFrame_Begin(&frame, controlCommands[SPECSONGINTER_CMD][CMD_OPCODE_INDEX]);
+    DYFrame_PutByte(&frame, (uint8_t)device);
+    DYFrame_PutWord(&frame, number);
+    sendFrame(player, &frame);
 }
 /*******************************************************************************
-  @func    : interludeSpecifiedDevicePath
-  @param   : device_t device, char *path
+  @func    : DYPlayer_InterludeSpecifiedDevicePath
+  @param   : DYPlayer_t *player, device_t device, char *path
   @return  : void
   @date	   : 30.11.22
   @brief   : Play an interlude by device and path.
@@ -556,113 +964,115 @@ void interludeSpecified(device_t device, uint16_t number) {
              played immediately). When the interlude is finished, it will return to
              the first interlude breakpoint and continue to play.
 ********************************************************************************/
-void interludeSpecifiedDevicePath(device_t device, char *path) {
-    DYPlayer.byPathCommand(0x17, device, path);
+void DYPlayer_InterludeSpecifiedDevicePath(DYPlayer_t *player, device_t device, char *path) {
+    byPath(player, 0x17, device, path);
 }
 /*******************************************************************************
-  @func    : stopInterlude
-  @param   : void
+  @func    : DYPlayer_StopInterlude
+  @param   : DYPlayer_t *player
   @return  : void
   @date	   : 30.11.22
   @brief   : Stop the interlude and continue playing.
 ********************************************************************************/
-void stopInterlude(void) {
+void DYPlayer_StopInterlude(DYPlayer_t *player) {
     /*
     uint8_t command[3] = {0xaa, 0x10, 0x00};
     sendCommand(command, 3, 0xba);
     */
-    sendCommand(&controlCommands[STOP_PLAYING][0],
-                LENGTHOF_COMMANDS,
-                controlCommands[STOP_PLAYING][CMD_CRC_INDEX]);
+    sendControl(player, STOP_PLAYING);
 }
 /*******************************************************************************
-  @func    : setCycleMode
-  @param   : play_mode_t mode
+  @func    : DYPlayer_SetCycleMode
+  @param   : DYPlayer_t *player, play_mode_t mode
   @return  : void
   @date	   : 30.11.22
   @brief   : Sets the cycle mode
 ********************************************************************************/
-void setCycleMode(play_mode_t mode) {
+void DYPlayer_SetCycleMode(DYPlayer_t *player, play_mode_t mode) {
     /*
     uint8_t command[4] = { 0xaa, 0x18, 0x01, 0x00 };
     */
-    uint8_t command[4] = {0};
+    if (redundant(player, DY_SHADOW_MODE, (player->shadow.mode == mode),
+                  DY_FRAME_OVERHEAD + 1)) return;
 
-    memcpy(&command[0],
-           &controlCommands[SETLOOPMODE_CMD][0],
-           LENGTHOF_COMMANDS);
+    DYFrame_t frame;
 
-    command[3] = mode;
-    sendCommand_nocrc(command, 4);
+    DYFrame_Begin(&frame, controlCommands[SETLOOPMODE_CMD][CMD_OPCODE_INDEX]);
+    DYFrame_PutByte(&frame, mode);
+    sendFrame(player, &frame);
+
+    player->shadow.mode   = mode;
+    player->shadow.known |= DY_SHADOW_MODE;
 }
 /*******************************************************************************
-  @func    : setCycleTimes
-  @param   : uint16_t cycles
+  @func    : DYPlayer_SetCycleTimes
+  @param   : DYPlayer_t *player, uint16_t cycles
   @return  : void
   @date	   : 30.11.22
   @brief   : Set how many cycles to play when in cycle modes 0, 1 or 4
 ********************************************************************************/
-void setCycleTimes(uint16_t cycles) {
+void DYPlayer_SetCycleTimes(DYPlayer_t *player, uint16_t cycles) {
     /*
     uint8_t command[5] = { 0xaa, 0x19, 0x02, 0x00, 0x00 };
     */
 
-    uint8_t command[5] = {0};
+    if (redundant(player, DY_SHADOW_CYCLES, (player->shadow.cycles == cycles),
+                  DY_FRAME_OVERHEAD + 2)) return;
+
+    DYFrame_t frame;
 
-    memcpy(&command[0],
-           &controlCommands[SETCYCTIMES_CMD][0],
-           LENGTHOF_COMMANDS);
+    DYFrame_Begin(&frame, controlCommands[SETCYCTIMES_CMD][CMD_OPCODE_INDEX]);
+    DYFrame_PutWord(&frame, cycles);
+    sendFrame(player, &frame);
 
-    command[3] = cycles >> 8;
-    command[4] = cycles & 0xff;
-    sendCommand_nocrc(command, 5);
+    player->shadow.cycles = cycles;
+    player->shadow.known |= DY_SHADOW_CYCLES;
 }
 /*******************************************************************************
-  @func    : setEq
-  @param   : eq_t eq
+  @func    : DYPlayer_SetEq
+  @param   : DYPlayer_t *player, eq_t eq
   @return  : void
   @date	   : 30.11.22
   @brief   : Set the equalizer setting.
 ********************************************************************************/
-void setEq(eq_t eq) {
+void DYPlayer_SetEq(DYPlayer_t *player, eq_t eq) {
     /*
      uint8_t command[4] = { 0xaa, 0x1a, 0x01, 0x00 };
      */
 
-    uint8_t command[4] = {0};
+    if (redundant(player, DY_SHADOW_EQ, (player->shadow.eq == eq),
+                  DY_FRAME_OVERHEAD + 1)) return;
+
+    DYFrame_t frame;
 
-    memcpy(&command[0],
-           &controlCommands[SETEQ_CMD][0],
-           LENGTHOF_COMMANDS);
+    DYFrame_Begin(&frame, controlCommands[SETEQ_CMD][CMD_OPCODE_INDEX]);
+    DYFrame_PutByte(&frame, (uint8_t)eq);
+    sendFrame(player, &frame);
 
-    command[3] = (uint8_t)eq;
-    sendCommand_nocrc(command, 4);
+    player->shadow.eq     = eq;
+    player->shadow.known |= DY_SHADOW_EQ;
 }
 /*******************************************************************************
-  @func    : select
-  @param   : uint16_t number
+  @func    : DYPlayer_Select
+  @param   : DYPlayer_t *player, uint16_t number
   @return  : void
   @date	   : 30.11.22
   @brief   : Select a sound file without playing it.  e.g. `1` for `00001.mp3`.
 ********************************************************************************/
-void select(uint16_t number) {
+void DYPlayer_Select(DYPlayer_t *player, uint16_t number) {
     /*
     uint8_t command[5] = { 0xaa, 0x1f, 0x02, 0x00, 0x00};
     */
 
-    uint8_t command[5] = {0};
-
-    memcpy(&command[0],
-           &controlCommands[SLCTBUTNOPLAY_CMD][0],
-           LENGTHOF_COMMANDS);
+    DYFrame_t frame;
 
-    command[3] = number >> 8;
-    command[4] = number & 0xff;
-    sendCommand_nocrc(command, 5);
+    DYFrame_Begin(&frame, controlCommands[SLCTBUTNOPLAY_CMD][CMD_OPCODE_INDEX]);
+    DYFrame_PutWord(&frame, number);
+    sendFrame(player, &frame);
 }
 /*******************************************************************************
-  @func    : combinationPlay
-  @param   : char *sounds[], uint8_t len
+  @func    : DYPlayer_CombinationPlay
+  @param   : DYPlayer_t *player, char *sounds[], uint8_t len
   @return  : void
   @date	   : 30.11.22
   @brief   : Combination play allows you to make a playlist of multiple sound files.
@@ -678,35 +1088,400 @@ void select(uint16_t number) {
              the manual that came with your module, or try all of them. There may
              well be more combinations! Also see
 ********************************************************************************/
-void combinationPlay(char *sounds[], uint8_t len) {
+void DYPlayer_CombinationPlay(DYPlayer_t *player, char *sounds[], uint8_t len) {
     if (len < 1) return;
-    // This part of the command can be easily determined already.
-    uint8_t command[3] = {0xaa, 0x1b, 0x00};
-    command[2] = len * 2;
-    // Depends on the length, checksum is a sum so we can add the other values
-    // later.
-    uint8_t crc = checksum(command, 3);
-    // Send the command and length already.
-    serialWrite(command, 3);
-    // Send each pair of chars containing the file name and add the values of
-    // each char to the crc.
+
+    DYFrame_t frame;
+
+    DYFrame_Begin(&frame, 0x1b);
+    // Each sound is a pair of chars containing the file name, the length and
+    // the checksum are filled in when the frame is closed.
     for (uint8_t i = 0; i < len; i++) {
-        crc += checksum((uint8_t *)sounds[i], 2);
-        serialWrite((uint8_t *)sounds[i], 2);
+        DYFrame_PutBytes(&frame, (uint8_t *)sounds[i], 2);
     }
-    // Lastly, write the crc value.
-    serialWrite_crc(crc);
+    sendFrame(player, &frame);
 }
 /*******************************************************************************
-  @func    : endCombinationPlay
-  @param   : void
+  @func    : DYPlayer_EndCombinationPlay
+  @param   : DYPlayer_t *player
   @return  : void
   @date	   : 30.11.2022
   @brief   : End combination play.
 ********************************************************************************/
-void endCombinationPlay(void) {
+void DYPlayer_EndCombinationPlay(DYPlayer_t *player) {
+    /*
     uint8_t command[3] = {0xaa, 0x1c, 0x00};
     DYPlayer.sendCommand(command, 3, 0xc6);
+    */
+    DYFrame_t frame;
+
+    DYFrame_Begin(&frame, 0x1c);
+    sendFrame(player, &frame);
+}
+
+/******************************************************************************/
+/*
+ * Calls without an instance argument, the `DYPlayer` method struct points at
+ * them. Each goes to the instance of DYPlayer_Init() or DYPlayer_Use() and
+ * does nothing (or fails) while there is none. Code driving several modules,
+ * or calling from several tasks, uses the DYPlayer_ calls instead.
+ */
+/******************************************************************************/
+/*******************************************************************************
+  @func    : serialWrite
+  @param   : const uint8_t *buffer, uint8_t len
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYPlayer_Write() on the instance in use.
+********************************************************************************/
+void serialWrite(const uint8_t *buffer, uint8_t len) {
+    if (dyPlayer != NULL) DYPlayer_Write(dyPlayer, buffer, len);
+}
+/*******************************************************************************
+  @func    : serialWrite_crc
+  @param   : uint8_t crc
+  @return  : void
+  @date	   : 30.11.22
+  @brief   : Map writing a single byte to the same method as writing a buffer of
+             length 1. That buffer has crc value
+********************************************************************************/
+void serialWrite_crc(uint8_t crc) {
+    uint8_t buf[1];
+    buf[0] = crc;
+
+    serialWrite(&buf[0], 1);
+}
+/*******************************************************************************
+  @func    : serialRead
+  @param   : uint8_t *buffer, uint8_t len
+  @return  : uint8_t
+  @date	   : 16.10.26
+  @brief   : DYPlayer_Read() on the instance in use.
+********************************************************************************/
+uint8_t serialRead(uint8_t *buffer, uint8_t len) {
+    return (dyPlayer != NULL) ? DYPlayer_Read(dyPlayer, buffer, len) : 0;
+}
+/*******************************************************************************
+  @func    : checkPlayState
+  @param   : void
+  @return  : play_state_t
+  @date	   : 16.10.26
+  @brief   : DYPlayer_CheckPlayState() on the instance in use.
+********************************************************************************/
+play_state_t checkPlayState(void) {
+    return (dyPlayer != NULL) ? DYPlayer_CheckPlayState(dyPlayer) : Fail;
+}
+/*******************************************************************************
+  @func    : play
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYPlayer_Play() on the instance in use.
+********************************************************************************/
+void play(void) {
+    if (dyPlayer != NULL) DYPlayer_Play(dyPlayer);
+}
+/*******************************************************************************
+  @func    : pause
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYPlayer_Pause() on the instance in use.
+********************************************************************************/
+void pause(void) {
+    if (dyPlayer != NULL) DYPlayer_Pause(dyPlayer);
+}
+/*******************************************************************************
+  @func    : stop
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYPlayer_Stop() on the instance in use.
+********************************************************************************/
+void stop(void) {
+    if (dyPlayer != NULL) DYPlayer_Stop(dyPlayer);
+}
+/*******************************************************************************
+  @func    : previous
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYPlayer_Previous() on the instance in use.
+********************************************************************************/
+void previous(void) {
+    if (dyPlayer != NULL) DYPlayer_Previous(dyPlayer);
+}
+/*******************************************************************************
+  @func    : next
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYPlayer_Next() on the instance in use.
+********************************************************************************/
+void next(void) {
+    if (dyPlayer != NULL) DYPlayer_Next(dyPlayer);
+}
+/*******************************************************************************
+  @func    : playSpecified
+  @param   : uint16_t number
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYPlayer_PlaySpecified() on the instance in use.
+********************************************************************************/
+void playSpecified(uint16_t number) {
+    if (dyPlayer != NULL) DYPlayer_PlaySpecified(dyPlayer, number);
+}
+/*******************************************************************************
+  @func    : playSpecifiedDevicePath
+  @param   : device_t device, char *path
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYPlayer_PlaySpecifiedDevicePath() on the instance in use.
+********************************************************************************/
+void playSpecifiedDevicePath(device_t device, char *path) {
+    if (dyPlayer != NULL) DYPlayer_PlaySpecifiedDevicePath(dyPlayer, device, path);
+}
+/*******************************************************************************
+  @func    : getPlayingDevice
+  @param   : void
+  @return  : device_t
+  @date	   : 16.10.26
+  @brief   : DYPlayer_GetPlayingDevice() on the instance in use.
+********************************************************************************/
+device_t getPlayingDevice(void) {
+    return (dyPlayer != NULL) ? DYPlayer_GetPlayingDevice(dyPlayer) : Failed;
+}
+/*******************************************************************************
+  @func    : setPlayingDevice
+  @param   : device_t device
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYPlayer_SetPlayingDevice() on the instance in use.
+********************************************************************************/
+void setPlayingDevice(device_t device) {
+    if (dyPlayer != NULL) DYPlayer_SetPlayingDevice(dyPlayer, device);
+}
+/*******************************************************************************
+  @func    : getSoundCount
+  @param   : void
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : DYPlayer_GetSoundCount() on the instance in use.
+********************************************************************************/
+uint16_t getSoundCount(void) {
+    return (dyPlayer != NULL) ? DYPlayer_GetSoundCount(dyPlayer) : 0;
+}
+/*******************************************************************************
+  @func    : getPlayingSound
+  @param   : void
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : DYPlayer_GetPlayingSound() on the instance in use.
+********************************************************************************/
+uint16_t getPlayingSound(void) {
+    return (dyPlayer != NULL) ? DYPlayer_GetPlayingSound(dyPlayer) : 0;
+}
+/*******************************************************************************
+  @func    : previousDir
+  @param   : playDirSound_t song
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYPlayer_PreviousDir() on the instance in use.
+********************************************************************************/
+void previousDir(playDirSound_t song) {
+    if (dyPlayer != NULL) DYPlayer_PreviousDir(dyPlayer, song);
+}
+/*******************************************************************************
+  @func    : getFirstInDir
+  @param   : void
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : DYPlayer_GetFirstInDir() on the instance in use.
+********************************************************************************/
+uint16_t getFirstInDir(void) {
+    return (dyPlayer != NULL) ? DYPlayer_GetFirstInDir(dyPlayer) : 0;
+}
+/*******************************************************************************
+  @func    : getSoundCountDir
+  @param   : void
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : DYPlayer_GetSoundCountDir() on the instance in use.
+********************************************************************************/
+uint16_t getSoundCountDir(void) {
+    return (dyPlayer != NULL) ? DYPlayer_GetSoundCountDir(dyPlayer) : 0;
+}
+/*******************************************************************************
+  @func    : setVolume
+  @param   : uint8_t volume
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYPlayer_SetVolume() on the instance in use.
+********************************************************************************/
+void setVolume(uint8_t volume) {
+    if (dyPlayer != NULL) DYPlayer_SetVolume(dyPlayer, volume);
+}
+/*******************************************************************************
+  @func    : volumeIncrease
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYPlayer_VolumeIncrease() on the instance in use.
+********************************************************************************/
+void volumeIncrease(void) {
+    if (dyPlayer != NULL) DYPlayer_VolumeIncrease(dyPlayer);
+}
+/*******************************************************************************
+  @func    : volumeDecrease
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYPlayer_VolumeDecrease() on the instance in use.
+********************************************************************************/
+void volumeDecrease(void) {
+    if (dyPlayer != NULL) DYPlayer_VolumeDecrease(dyPlayer);
+}
+/*******************************************************************************
+  @func    : interludeSpecified
+  @param   : device_t device, uint16_t number
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYPlayer_InterludeSpecified() on the instance in use.
+********************************************************************************/
+void interludeSpecified(device_t device, uint16_t number) {
+    if (dyPlayer != NULL) DYPlayer_InterludeSpecified(dyPlayer, device, number);
+}
+/*******************************************************************************
+  @func    : interludeSpecifiedDevicePath
+  @param   : device_t device, char *path
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYPlayer_InterludeSpecifiedDevicePath() on the instance in use.
+********************************************************************************/
+void interludeSpecifiedDevicePath(device_t device, char *path) {
+    if (dyPlayer != NULL) DYPlayer_InterludeSpecifiedDevicePath(dyPlayer, device, path);
+}
+/*******************************************************************************
+  @func    : stopInterlude
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYPlayer_StopInterlude() on the instance in use.
+********************************************************************************/
+void stopInterlude(void) {
+    if (dyPlayer != NULL) DYPlayer_StopInterlude(dyPlayer);
+}
+/*******************************************************************************
+  @func    : setCycleMode
+  @param   : play_mode_t mode
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYPlayer_SetCycleMode() on the instance in use.
+********************************************************************************/
+void setCycleMode(play_mode_t mode) {
+    if (dyPlayer != NULL) DYPlayer_SetCycleMode(dyPlayer, mode);
+}
+/*******************************************************************************
+  @func    : setCycleTimes
+  @param   : uint16_t cycles
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYPlayer_SetCycleTimes() on the instance in use.
+********************************************************************************/
+void setCycleTimes(uint16_t cycles) {
+    if (dyPlayer != NULL) DYPlayer_SetCycleTimes(dyPlayer, cycles);
+}
+/*******************************************************************************
+  @func    : setEq
+  @param   : eq_t eq
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYPlayer_SetEq() on the instance in use.
+********************************************************************************/
+void setEq(eq_t eq) {
+    if (dyPlayer != NULL) DYPlayer_SetEq(dyPlayer, eq);
+}
+/*******************************************************************************
+  @func    : select
+  @param   : uint16_t number
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYPlayer_Select() on the instance in use.
+********************************************************************************/
+void select(uint16_t number) {
+    if (dyPlayer != NULL) DYPlayer_Select(dyPlayer, number);
+}
+/*******************************************************************************
+  @func    : combinationPlay
+  @param   : char *sounds[], uint8_t len
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYPlayer_CombinationPlay() on the instance in use.
+********************************************************************************/
+void combinationPlay(char *sounds[], uint8_t len) {
+    if (dyPlayer != NULL) DYPlayer_CombinationPlay(dyPlayer, sounds, len);
+}
+/*******************************************************************************
+  @func    : endCombinationPlay
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYPlayer_EndCombinationPlay() on the instance in use.
+********************************************************************************/
+void endCombinationPlay(void) {
+    if (dyPlayer != NULL) DYPlayer_EndCombinationPlay(dyPlayer);
+}
+/*******************************************************************************
+  @func    : getResponse
+  @param   : uint8_t *buffer, uint8_t len, uint8_t opcode
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : DYPlayer_GetResponse() on the instance in use.
+********************************************************************************/
+bool getResponse(uint8_t *buffer, uint8_t len, uint8_t opcode) {
+    return (dyPlayer != NULL) ? DYPlayer_GetResponse(dyPlayer, buffer, len, opcode) : false;
+}
+/*******************************************************************************
+  @func    : sendCommand_nocrc
+  @param   : void
+  @return  : uint8_t *data, uint8_t len
+  @date	   : 30.11.22
+  @brief   : Send a command to the module, adds a CRC to the passed buffer.
+             Data and CRC leave in one write.
+********************************************************************************/
+void sendCommand_nocrc(uint8_t *data, uint8_t len) {
+    uint8_t frame[DY_FRAME_MAX];
+
+    if (len >= DY_FRAME_MAX) return;
+    memcpy(&frame[0], data, len);
+    frame[len] = checksum(data, len);
+    serialWrite(&frame[0], len + 1);
+}
+/*******************************************************************************
+  @func    : sendCommand
+  @param   : uint8_t *data, uint8_t len, uint8_t crc
+  @return  : void
+  @date	   : 30.11.22
+  @brief   : data pointer to bytes to send to the module.
+             Data and CRC leave in one write.
+********************************************************************************/
+void sendCommand(const uint8_t *data, uint8_t len, uint8_t crc) {
+    uint8_t frame[DY_FRAME_MAX];
+
+    if (len >= DY_FRAME_MAX) return;
+    memcpy(&frame[0], data, len);
+    frame[len] = crc;
+    serialWrite(&frame[0], len + 1);
+}
+/*******************************************************************************
+  @func    : byPathCommand
+  @param   : uint8_t command, device_t device, char *path
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : byPath() on the instance in use.
+********************************************************************************/
+void byPathCommand(uint8_t command, device_t device, char *path) {
+    if (dyPlayer != NULL) byPath(dyPlayer, command, device, path);
 }
 /*******************************************************************************
   @func    : getCycleMode
@@ -720,12 +1495,11 @@ void getCycleMode(play_mode_t mode) {
     uint8_t command[4] = {0xaa, 0x18, 0x01, 0x00};
     */
 
-    uint8_t command[4] = {0};
+    if (dyPlayer == NULL) return;
 
-    memcpy(&command[0],
-           &controlCommands[SETLOOPMODE_CMD][0],
-           LENGTHOF_COMMANDS);
+    DYFrame_t frame;
 
-    command[3] = mode;
-    DYPlayer.sendCommand_nocrc(command, 4);
+    DYFrame_Begin(&frame, controlCommands[SETLOOPMODE_CMD][CMD_OPCODE_INDEX]);
+    DYFrame_PutByte(&frame, mode);
+    sendFrame(dyPlayer, &frame);
 }
@@ -0,0 +1,307 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_Batch.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Multi command batches, built once and sent in one transport write.
+********************************************************************************/
+/************************************INCLUDES***********************************/
+#include <string.h>
+
+#include "DYPlayer_Batch.h"
+
+
+/*******************************************************************************
+  @func    : DYBatch_Begin
+  @param   : DYBatchBuilder_t *builder
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Start an empty batch.
+********************************************************************************/
+void DYBatch_Begin(DYBatchBuilder_t *builder) {
+    builder->len      = 0;
+    builder->overflow = false;
+}
+/*******************************************************************************
+  @func    : put
+  @param   : DYBatchBuilder_t *builder, const uint8_t *frame, uint8_t len
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Append a complete frame, or mark the batch invalid when it does
+             not fit. A frame is never split.
+********************************************************************************/
+static void put(DYBatchBuilder_t *builder, const uint8_t *frame, uint8_t len) {
+    if ((len == 0) || ((builder->len + len) > DY_BATCH_MAX)) {
+        builder->overflow = true;
+        return;
+    }
+    memcpy(&builder->data[builder->len], frame, len);
+    builder->len += len;
+}
+/*******************************************************************************
+  @func    : DYBatch_AddFrame
+  @param   : DYBatchBuilder_t *builder, DYFrame_t *frame
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Close a frame begun with DYFrame_Begin() and append it.
+********************************************************************************/
+void DYBatch_AddFrame(DYBatchBuilder_t *builder, DYFrame_t *frame) {
+    put(builder, &frame->data[0], DYFrame_End(frame));
+}
+/*******************************************************************************
+  @func    : DYBatch_AddControl
+  @param   : DYBatchBuilder_t *builder, uint8_t index
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Append one of the constant commands of `controlCommands`.
+********************************************************************************/
+void DYBatch_AddControl(DYBatchBuilder_t *builder, uint8_t index) {
+    if (index >= SIZEOF_COMMANDS) {
+        builder->overflow = true;
+        return;
+    }
+    put(builder, &controlCommands[index][0], LENGTHOF_COMMANDS + LENGTHOF_CRC);
+}
+/*******************************************************************************
+  @func    : addByte
+  @param   : DYBatchBuilder_t *builder, uint8_t index, uint8_t byte
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Append the command `index` with one data byte.
+********************************************************************************/
+static void addByte(DYBatchBuilder_t *builder, uint8_t index, uint8_t byte) {
+    DYFrame_t frame;
+
+    DYFrame_Begin(&frame, controlCommands[index][CMD_OPCODE_INDEX]);
+    DYFrame_PutByte(&frame, byte);
+    DYBatch_AddFrame(builder, &frame);
+}
+/*******************************************************************************
+  @func    : addWord
+  @param   : DYBatchBuilder_t *builder, uint8_t index, uint16_t word
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Append the command `index` with a 16 bit argument.
+********************************************************************************/
+static void addWord(DYBatchBuilder_t *builder, uint8_t index, uint16_t word) {
+    DYFrame_t frame;
+
+    DYFrame_Begin(&frame, controlCommands[index][CMD_OPCODE_INDEX]);
+    DYFrame_PutWord(&frame, word);
+    DYBatch_AddFrame(builder, &frame);
+}
+/*******************************************************************************
+  @func    : DYBatch_SetPlayingDevice
+  @param   : DYBatchBuilder_t *builder, device_t device
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Append setPlayingDevice(device).
+********************************************************************************/
+void DYBatch_SetPlayingDevice(DYBatchBuilder_t *builder, device_t device) {
+    addByte(builder, SWTICHDRIVE_CMD, (uint8_t)device);
+}
+/*******************************************************************************
+  @func    : DYBatch_SetVolume
+  @param   : DYBatchBuilder_t *builder, uint8_t volume
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Append setVolume(volume).
+********************************************************************************/
+void DYBatch_SetVolume(DYBatchBuilder_t *builder, uint8_t volume) {
+    addByte(builder, SETVOLUME_CMD, volume);
+}
+/*******************************************************************************
+  @func    : DYBatch_SetEq
+  @param   : DYBatchBuilder_t *builder, eq_t eq
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Append setEq(eq).
+********************************************************************************/
+void DYBatch_SetEq(DYBatchBuilder_t *builder, eq_t eq) {
+    addByte(builder, SETEQ_CMD, (uint8_t)eq);
+}
+/*******************************************************************************
+  @func    : DYBatch_SetCycleMode
+  @param   : DYBatchBuilder_t *builder, play_mode_t mode
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Append setCycleMode(mode).
+********************************************************************************/
+void DYBatch_SetCycleMode(DYBatchBuilder_t *builder, play_mode_t mode) {
+    addByte(builder, SETLOOPMODE_CMD, (uint8_t)mode);
+}
+/*******************************************************************************
+  @func    : DYBatch_SetCycleTimes
+  @param   : DYBatchBuilder_t *builder, uint16_t cycles
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Append setCycleTimes(cycles).
+********************************************************************************/
+void DYBatch_SetCycleTimes(DYBatchBuilder_t *builder, uint16_t cycles) {
+    addWord(builder, SETCYCTIMES_CMD, cycles);
+}
+/*******************************************************************************
+  @func    : DYBatch_PlaySpecified
+  @param   : DYBatchBuilder_t *builder, uint16_t number
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Append playSpecified(number).
+********************************************************************************/
+void DYBatch_PlaySpecified(DYBatchBuilder_t *builder, uint16_t number) {
+    addWord(builder, SPECIFIEDSONG_CMD, number);
+}
+/*******************************************************************************
+  @func    : DYBatch_Select
+  @param   : DYBatchBuilder_t *builder, uint16_t number
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Append select(number).
+********************************************************************************/
+void DYBatch_Select(DYBatchBuilder_t *builder, uint16_t number) {
+    addWord(builder, SLCTBUTNOPLAY_CMD, number);
+}
+/*******************************************************************************
+  @func    : DYBatch_End
+  @param   : DYBatchBuilder_t *builder, DYBatch_t *batch
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Point `batch` at the built frames. False when one of them did not
+             fit, nothing of such a batch should be sent.
+********************************************************************************/
+bool DYBatch_End(DYBatchBuilder_t *builder, DYBatch_t *batch) {
+    batch->data = &builder->data[0];
+    batch->len  = builder->overflow ? 0 : builder->len;
+    return !builder->overflow && (builder->len > 0);
+}
+/*******************************************************************************
+  @func    : frameAt
+  @param   : const DYBatch_t *batch, uint16_t pos
+  @return  : uint8_t
+  @date	   : 16.10.26
+  @brief   : Length of the frame starting at `pos`, 0 when the bytes there are
+             not a complete frame with a matching checksum.
+********************************************************************************/
+static uint8_t frameAt(const DYBatch_t *batch, uint16_t pos) {
+    const uint8_t *frame = &batch->data[pos];
+    uint16_t       left  = batch->len - pos;
+
+    if ((left < DY_FRAME_OVERHEAD) || (frame[0] != DY_FRAME_HEADER)) {
+        return 0;
+    }
+
+    uint16_t len = frame[DY_FRAME_LEN_INDEX] + DY_FRAME_OVERHEAD;
+    if ((len > DY_FRAME_MAX) || (len > left)) {
+        return 0;
+    }
+
+    uint8_t sum = 0;
+    for (uint16_t i = 0; i < (len - 1); i++) {
+        sum += frame[i];
+    }
+    return (sum == frame[len - 1]) ? (uint8_t)len : 0;
+}
+/*******************************************************************************
+  @func    : DYBatch_Validate
+  @param   : const DYBatch_t *batch
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : True when the batch is a whole number of well formed frames.
+********************************************************************************/
+bool DYBatch_Validate(const DYBatch_t *batch) {
+    uint16_t pos = 0;
+
+    if ((batch->data == NULL) || (batch->len == 0)) {
+        return false;
+    }
+    while (pos < batch->len) {
+        uint8_t len = frameAt(batch, pos);
+        if (len == 0) {
+            return false;
+        }
+        pos += len;
+    }
+    return true;
+}
+/*******************************************************************************
+  @func    : writeAll
+  @param   : DYPlayer_t *player, const uint8_t *data, uint16_t len
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Hand `len` bytes to the transport like serialWrite(), giving up
+             when no room shows up within DY_TX_TIMEOUT. Returns the bytes
+             the transport took.
+********************************************************************************/
+static uint16_t writeAll(DYPlayer_t *player, const uint8_t *data, uint16_t len) {
+    const DYTransport_st *io    = player->transport;
+    uint32_t              start = io->now(player->ctx);
+    uint16_t              sent  = 0;
+
+    while (sent < len) {
+        uint16_t n = io->write(player->ctx, &data[sent], len - sent);
+        if (n == 0) {
+            if ((io->now(player->ctx) - start) >= (DY_TX_TIMEOUT * 1000U)) {
+                break;
+            }
+            io->wait(player->ctx, DY_TX_RETRY);
+        }
+        sent += n;
+    }
+    return sent;
+}
+/*******************************************************************************
+  @func    : DYBatch_Send
+  @param   : DYPlayer_t *player, const DYBatch_t *batch
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Send every frame of the batch. The batch is checked first and
+             nothing goes out unless every frame is well formed.
+
+             With DY_BATCH_GAP_US at 0 the whole batch is one write, on the
+             DMA transport one transfer (flash batches are sent in place, RAM
+             ones must fit a DMA slot). Otherwise each frame is written on
+             its own and the next one waits until it had time to leave the
+             UART plus the gap.
+
+             The shadow state and the counters of the instance take every
+             frame that went out. Returns false when the batch was invalid or
+             the transport did not take all of it.
+********************************************************************************/
+bool DYBatch_Send(DYPlayer_t *player, const DYBatch_t *batch) {
+    uint16_t sent = 0;
+    uint16_t pos  = 0;
+#if DY_BATCH_GAP_US != 0
+    uint8_t  prev = 0;
+#endif
+
+    if ((player == NULL) || !DYBatch_Validate(batch)) {
+        return false;
+    }
+
+#if DY_BATCH_GAP_US == 0
+    sent = writeAll(player, &batch->data[0], batch->len);
+#endif
+
+    while (pos < batch->len) {
+        uint8_t len = frameAt(batch, pos);
+
+#if DY_BATCH_GAP_US != 0
+        if (pos > 0) {
+            /* Queueing transports return at once, let the last frame leave. */
+            player->transport->wait(player->ctx, ((uint32_t)prev * DY_BATCH_BYTE_US) + DY_BATCH_GAP_US);
+        }
+        prev  = len;
+        sent += writeAll(player, &batch->data[pos], len);
+#endif
+        if (sent < (pos + len)) {
+            player->txDropped++;
+            break;
+        }
+        DYShadow_Record(&player->shadow, &batch->data[pos]);
+        player->txFrames++;
+        player->txBytes += len;
+        pos += len;
+    }
+    return sent == batch->len;
+}
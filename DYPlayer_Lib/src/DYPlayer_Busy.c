@@ -0,0 +1,198 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_Busy.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 BUSY pin debounce and events.
+********************************************************************************/
+/************************************INCLUDES***********************************/
+#include <stddef.h>
+
+#include "DYPlayer_Busy.h"
+
+
+/*******************************************************************************
+  @func    : DYBusy_Init
+  @param   : DYBusy_t *busy, bool activeLow, uint32_t debounce, bool level,
+             uint32_t now
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Start from the pin `level` read at `now`, before the pin
+             interrupt is enabled. `debounce` is in the unit of `now`.
+********************************************************************************/
+void DYBusy_Init(DYBusy_t *busy, bool activeLow, uint32_t debounce, bool level, uint32_t now) {
+    busy->activeLow = activeLow;
+    busy->debounce  = debounce;
+    busy->callback  = NULL;
+    busy->ctx       = NULL;
+    busy->level     = level;
+    busy->playing   = (level != activeLow);
+    busy->edgeAt    = now - debounce;
+    busy->startedAt = now;
+    busy->endedAt   = now;
+    busy->starts    = 0;
+    busy->ends      = 0;
+    busy->bounces   = 0;
+}
+/*******************************************************************************
+  @func    : DYBusy_SetCallback
+  @param   : DYBusy_t *busy, DYBusy_Callback_t callback, void *ctx
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Called on every debounced start and end, NULL for none.
+********************************************************************************/
+void DYBusy_SetCallback(DYBusy_t *busy, DYBusy_Callback_t callback, void *ctx) {
+    busy->callback = callback;
+    busy->ctx      = ctx;
+}
+/*******************************************************************************
+  @func    : maskIrq
+  @param   : void
+  @return  : uint32_t
+  @date	   : 16.10.26
+  @brief   : Mask interrupts on Cortex-M, returns PRIMASK before. Nothing on
+             other targets, Edge and Poll then share one context.
+********************************************************************************/
+static inline uint32_t maskIrq(void) {
+#if defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
+    uint32_t primask;
+
+    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (primask) :: "memory");
+    return primask;
+#else
+    return 0;
+#endif
+}
+/*******************************************************************************
+  @func    : unmaskIrq
+  @param   : uint32_t primask
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Restore PRIMASK from maskIrq().
+********************************************************************************/
+static inline void unmaskIrq(uint32_t primask) {
+#if defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
+    __asm volatile ("msr primask, %0" :: "r" (primask) : "memory");
+#else
+    (void)primask;
+#endif
+}
+/*******************************************************************************
+  @func    : settle
+  @param   : DYBusy_t *busy, uint32_t at
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Take the last level seen as the state. True if it changed, `at`
+             is the time of the edge that led to it.
+********************************************************************************/
+static bool settle(DYBusy_t *busy, uint32_t at) {
+    bool playing = (busy->level != busy->activeLow);
+
+    if (playing == busy->playing) {
+        return false;
+    }
+    busy->playing = playing;
+
+    if (playing) {
+        busy->startedAt = at;
+        busy->starts++;
+    } else {
+        busy->endedAt = at;
+        busy->ends++;
+    }
+    return true;
+}
+/*******************************************************************************
+  @func    : edge
+  @param   : DYBusy_t *busy, bool level, uint32_t now, uint32_t *at
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Pin changed to `level` at `now`. The level before held since the
+             last edge; if that was `debounce` or more it counts even though
+             no Poll saw it, true if the state changed, stamped `*at`. A
+             shorter one is bounce. The new level counts once it held too.
+********************************************************************************/
+static bool edge(DYBusy_t *busy, bool level, uint32_t now, uint32_t *at) {
+    bool changed = false;
+
+    if ((now - busy->edgeAt) >= busy->debounce) {
+        *at     = busy->edgeAt;
+        changed = settle(busy, *at);
+    } else {
+        busy->bounces++;
+    }
+    busy->level  = level;
+    busy->edgeAt = now;
+    return changed;
+}
+/*******************************************************************************
+  @func    : report
+  @param   : DYBusy_t *busy, bool playing, uint32_t at
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Raise the event of a state change to `playing` at `at`.
+********************************************************************************/
+static void report(DYBusy_t *busy, bool playing, uint32_t at) {
+    if (busy->callback != NULL) {
+        busy->callback(busy->ctx, playing ? DY_BUSY_STARTED : DY_BUSY_ENDED, at);
+    }
+}
+/*******************************************************************************
+  @func    : DYBusy_Edge
+  @param   : DYBusy_t *busy, bool level, uint32_t now
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Pin changed to `level` at `now`, from the EXTI interrupt. Only
+             starts the hold time of the new level, its event comes from
+             DYBusy_Poll() once it held for `debounce`, or from the next edge.
+********************************************************************************/
+void DYBusy_Edge(DYBusy_t *busy, bool level, uint32_t now) {
+    uint32_t at;
+
+    if (edge(busy, level, now, &at)) {
+        report(busy, busy->playing, at);
+    }
+}
+/*******************************************************************************
+  @func    : DYBusy_Poll
+  @param   : DYBusy_t *busy, bool level, uint32_t now
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Pin reads `level` at `now`. Takes the level once it held for
+             `debounce`, stamped with the time of its edge, and starts the
+             hold time of an edge the interrupt did not report at `now`. The
+             state update runs with interrupts masked on Cortex-M, so a
+             DYBusy_Edge() from EXTI lands before or after it, never inside.
+             The callback runs after unmasking.
+********************************************************************************/
+void DYBusy_Poll(DYBusy_t *busy, bool level, uint32_t now) {
+    uint32_t primask = maskIrq();
+    uint32_t at      = now;
+    bool     changed = false;
+    bool     playing;
+
+    if (level != busy->level) {
+        changed = edge(busy, level, now, &at);
+    } else if ((now - busy->edgeAt) >= busy->debounce) {
+        at      = busy->edgeAt;
+        changed = settle(busy, at);
+    }
+    playing = busy->playing;
+    unmaskIrq(primask);
+
+    if (changed) {
+        report(busy, playing, at);
+    }
+}
+/*******************************************************************************
+  @func    : DYBusy_Playing
+  @param   : const DYBusy_t *busy
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Audio is coming out, debounced.
+********************************************************************************/
+bool DYBusy_Playing(const DYBusy_t *busy) {
+    return busy->playing;
+}
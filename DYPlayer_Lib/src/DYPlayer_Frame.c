@@ -0,0 +1,125 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_Frame.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Builds a complete DY-XXXX command frame in one contiguous buffer.
+********************************************************************************/
+
+/************************************INCLUDES***********************************/
+#include <ctype.h>
+#include <stddef.h>
+
+#include "DYPlayer_Frame.h"
+
+
+/*******************************************************************************
+  @func    : DYFrame_Begin
+  @param   : DYFrame_t *frame, uint8_t command
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Start a new frame: header, command and a length placeholder.
+********************************************************************************/
+void DYFrame_Begin(DYFrame_t *frame, uint8_t command) {
+    frame->data[0]                  = DY_FRAME_HEADER;
+    frame->data[1]                  = command;
+    frame->data[DY_FRAME_LEN_INDEX] = 0;
+    frame->len                      = 3;
+    frame->sum                      = (uint8_t)(DY_FRAME_HEADER + command);
+    frame->overflow                 = false;
+}
+/*******************************************************************************
+  @func    : DYFrame_PutByte
+  @param   : DYFrame_t *frame, uint8_t byte
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Append one data byte, one byte is always kept free for the SM.
+********************************************************************************/
+void DYFrame_PutByte(DYFrame_t *frame, uint8_t byte) {
+    if (frame->len >= (DY_FRAME_MAX - 1)) {
+        frame->overflow = true;
+        return;
+    }
+    frame->data[frame->len++] = byte;
+    frame->sum               += byte;
+}
+/*******************************************************************************
+  @func    : DYFrame_PutWord
+  @param   : DYFrame_t *frame, uint16_t word
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Append a 16 bit value, high byte first as the module expects.
+********************************************************************************/
+void DYFrame_PutWord(DYFrame_t *frame, uint16_t word) {
+    DYFrame_PutByte(frame, word >> 8);
+    DYFrame_PutByte(frame, word & 0xff);
+}
+/*******************************************************************************
+  @func    : DYFrame_PutBytes
+  @param   : DYFrame_t *frame, const uint8_t *data, uint8_t len
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Append a block of data bytes.
+********************************************************************************/
+void DYFrame_PutBytes(DYFrame_t *frame, const uint8_t *data, uint8_t len) {
+    for (uint8_t i = 0; i < len; i++) {
+        DYFrame_PutByte(frame, data[i]);
+    }
+}
+/*******************************************************************************
+  @func    : DYFrame_PutPath
+  @param   : DYFrame_t *frame, const char *path
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Append a path converted to the weird format required by the
+             modules.
+
+             - Any dot in a path should become a star (`*`)
+             - Path ending slashes should be have a star prefix, except root.
+
+             E.g.: /SONGS1/FILE1.MP3 should become: /SONGS1﹡/FILE1*MP3
+             NOTE: This comment uses a unicode * look-a-alike (﹡) because ﹡/ end the
+             comment.
+********************************************************************************/
+void DYFrame_PutPath(DYFrame_t *frame, const char *path) {
+    if (path[0] == '\0') {
+        return;
+    }
+
+    DYFrame_PutByte(frame, (uint8_t)path[0]);
+    /* Stop at the first byte that didn't fit, the frame is invalid anyway. */
+    for (size_t i = 1; (path[i] != '\0') && !frame->overflow; i++) {
+        switch (path[i]) {
+            case '.':
+                DYFrame_PutByte(frame, '*');
+                break;
+            case '/':
+                DYFrame_PutByte(frame, '*');
+                DYFrame_PutByte(frame, '/');
+                break;
+            default:
+                DYFrame_PutByte(frame, (uint8_t)toupper((unsigned char)path[i]));
+        }
+    }
+}
+/*******************************************************************************
+  @func    : DYFrame_End
+  @param   : DYFrame_t *frame
+  @return  : uint8_t
+  @date	   : 16.10.26
+  @brief   : Patch the length byte and append the checksum. Returns the total
+             frame length, 0 if the frame overflowed and must not be sent.
+********************************************************************************/
+uint8_t DYFrame_End(DYFrame_t *frame) {
+    if (frame->overflow) {
+        return 0;
+    }
+
+    uint8_t length = frame->len - 3;
+    frame->data[DY_FRAME_LEN_INDEX] = length;
+    frame->sum                     += length;
+    frame->data[frame->len++]       = frame->sum;
+    return frame->len;
+}
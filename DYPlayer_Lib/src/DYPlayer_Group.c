@@ -0,0 +1,116 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_Group.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Pre-armed group start over several driver instances.
+********************************************************************************/
+/************************************DEFINES***********************************/
+
+#define GROUP_FRAME_LEN     (LENGTHOF_COMMANDS + LENGTHOF_CRC)
+
+/************************************INCLUDES***********************************/
+#include <string.h>
+
+#include "DYPlayer_Group.h"
+
+
+/*******************************************************************************
+  @func    : DYGroup_Init
+  @param   : DYGroup_t *group
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Empty group.
+********************************************************************************/
+void DYGroup_Init(DYGroup_t *group) {
+    memset(group, 0, sizeof(*group));
+}
+/*******************************************************************************
+  @func    : DYGroup_Add
+  @param   : DYGroup_t *group, DYPlayer_t *player
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Add an initialised instance. False when the group is full.
+********************************************************************************/
+bool DYGroup_Add(DYGroup_t *group, DYPlayer_t *player) {
+    if (group->count >= DY_GROUP_MAX) {
+        return false;
+    }
+    group->member[group->count++] = player;
+    return true;
+}
+/*******************************************************************************
+  @func    : DYGroup_Arm
+  @param   : DYGroup_t *group, uint16_t number
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Select track `number` on every member without playing it. Each
+             select is followed by a play state query, sent to all members
+             before the first answer is awaited, so the round trips overlap.
+             An answer means the module took the select and nothing is left
+             on its UART. Returns true when every member answered Stopped.
+********************************************************************************/
+bool DYGroup_Arm(DYGroup_t *group, uint16_t number) {
+    uint8_t buffer[5];
+    bool    armed = true;
+
+    for (uint8_t i = 0; i < group->count; i++) {
+        DYPlayer_t *member = group->member[i];
+
+        DYParser_Reset(&member->parser);
+        DYPlayer_Select(member, number);
+        DYPlayer_Write(member, &controlCommands[QPLAY_CMD][0], GROUP_FRAME_LEN);
+    }
+
+    for (uint8_t i = 0; i < group->count; i++) {
+        DYPlayer_t *member = group->member[i];
+
+        if (DYPlayer_GetResponse(member, &buffer[0], sizeof(buffer),
+                                 controlCommands[QPLAY_CMD][CMD_OPCODE_INDEX])) {
+            member->shadow.state  = (play_state_t)buffer[3];
+            member->shadow.known |= DY_SHADOW_STATE;
+            armed = armed && (member->shadow.state == Stopped);
+        } else {
+            armed = false;
+        }
+    }
+
+    return armed;
+}
+/*******************************************************************************
+  @func    : DYGroup_Fire
+  @param   : DYGroup_t *group
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Hand the play frame to every member's transport, one write each
+             and no waiting, so it may run in a timer interrupt. The frame is
+             the flash row of controlCommands[], sent in place by the DMA
+             transport. Returns false when a transport had no room for it.
+********************************************************************************/
+bool DYGroup_Fire(DYGroup_t *group) {
+    const uint8_t *play = &controlCommands[PLAY_CMD][0];
+    bool           fired = true;
+
+    for (uint8_t i = 0; i < group->count; i++) {
+        DYPlayer_t           *member = group->member[i];
+        const DYTransport_st *io     = member->transport;
+
+        if (i == 0) {
+            group->firedAt = io->now(member->ctx);
+        }
+        if (io->write(member->ctx, play, GROUP_FRAME_LEN) == GROUP_FRAME_LEN) {
+            DYShadow_Record(&member->shadow, play);
+            member->txFrames++;
+            member->txBytes += GROUP_FRAME_LEN;
+        } else {
+            member->txDropped++;
+            fired = false;
+        }
+        if (i == (group->count - 1)) {
+            group->fireUs = io->now(member->ctx) - group->firedAt;
+        }
+    }
+    return fired;
+}
@@ -0,0 +1,190 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_PortSTM32.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 STM32 HAL transports: blocking, interrupt and DMA.
+********************************************************************************/
+/************************************DEFINES***********************************/
+
+#define DY_HAL_TX_TIMEOUT   100     /* ms, blocking transmit of one frame      */
+#define DY_TRACE_OUT_TIMEOUT 1000   /* ms, debug UART transmit of a dump chunk */
+
+/************************************INCLUDES***********************************/
+#include "DYPlayer_PortSTM32.h"
+
+
+/*******************************************************************************
+  @func    : portNow
+  @param   : void *ctx
+  @return  : uint32_t
+  @date	   : 16.10.26
+  @brief   : Microsecond time stamp from the HAL millisecond tick. Also
+             restarts a stalled TX DMA queue, the driver asks for the time
+             in every wait and DYPlayer_Process() tick.
+********************************************************************************/
+static uint32_t portNow(void *ctx) {
+    DYPortSTM32_t *port = (DYPortSTM32_t *)ctx;
+
+    if (port->dmaTx != NULL) {
+        DYPlayer_UartDMA_Poll(port->dmaTx);
+    }
+    return HAL_GetTick() * 1000U;
+}
+/*******************************************************************************
+  @func    : portWait
+  @param   : void *ctx, uint32_t us
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Wait at least `us` microseconds, rounded up to the HAL tick.
+********************************************************************************/
+static void portWait(void *ctx, uint32_t us) {
+    (void)ctx;
+    HAL_Delay((us + 999U) / 1000U);
+}
+/*******************************************************************************
+  @func    : portRead
+  @param   : void *ctx, uint8_t *buffer, uint16_t len, uint32_t timeout
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Shared by all STM32 transports. With a DMA receiver the bytes are
+             already collected in the background, only missing ones are waited
+             for. Without it the UART is polled by HAL_UART_Receive.
+********************************************************************************/
+static uint16_t portRead(void *ctx, uint8_t *buffer, uint16_t len, uint32_t timeout) {
+    DYPortSTM32_t *port = (DYPortSTM32_t *)ctx;
+
+    if (port->dmaTx != NULL) {
+        DYPlayer_UartDMA_Poll(port->dmaTx);
+    }
+    if (port->dmaRx != NULL) {
+        uint32_t start = HAL_GetTick();
+        uint16_t got   = 0;
+
+        while (got < len) {
+            got += DYPlayer_UartDMA_Read(port->dmaRx, &buffer[got], len - got);
+            if (((HAL_GetTick() - start) * 1000U) >= timeout) {
+                break;
+            }
+        }
+        return got;
+    }
+
+    if (HAL_UART_Receive(port->huart, &buffer[0], len, timeout / 1000U) != HAL_OK) {
+        return len - port->huart->RxXferCount;
+    }
+    return len;
+}
+/*******************************************************************************
+  @func    : halWrite
+  @param   : void *ctx, const uint8_t *data, uint16_t len
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Blocking transmit, returns once the last byte is in the UART.
+********************************************************************************/
+static uint16_t halWrite(void *ctx, const uint8_t *data, uint16_t len) {
+    DYPortSTM32_t *port = (DYPortSTM32_t *)ctx;
+
+    if (HAL_UART_Transmit(port->huart, (uint8_t *)data, len, DY_HAL_TX_TIMEOUT) != HAL_OK) {
+        return 0;
+    }
+    return len;
+}
+/*******************************************************************************
+  @func    : itWrite
+  @param   : void *ctx, const uint8_t *data, uint16_t len
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Queue into the interrupt ring, all or nothing.
+********************************************************************************/
+static uint16_t itWrite(void *ctx, const uint8_t *data, uint16_t len) {
+    DYPortSTM32_t *port = (DYPortSTM32_t *)ctx;
+
+    return DYPlayer_UartIT_Write(port->itTx, data, len) ? len : 0;
+}
+/*******************************************************************************
+  @func    : dmaWrite
+  @param   : void *ctx, const uint8_t *data, uint16_t len
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Queue for the TX DMA, all or nothing.
+********************************************************************************/
+static uint16_t dmaWrite(void *ctx, const uint8_t *data, uint16_t len) {
+    DYPortSTM32_t *port = (DYPortSTM32_t *)ctx;
+
+    return DYPlayer_UartDMA_Write(port->dmaTx, data, len) ? len : 0;
+}
+
+/******************************************************************************/
+
+const DYTransport_st DYTransport_HAL = {
+    halWrite,
+    portRead,
+    portNow,
+    portWait,
+};
+
+const DYTransport_st DYTransport_IT = {
+    itWrite,
+    portRead,
+    portNow,
+    portWait,
+};
+
+const DYTransport_st DYTransport_DMA = {
+    dmaWrite,
+    portRead,
+    portNow,
+    portWait,
+};
+
+/******************************************************************************/
+
+/*******************************************************************************
+  @func    : DYPortSTM32_CyclesStart
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Start the DWT cycle counter, call once before tracing.
+********************************************************************************/
+void DYPortSTM32_CyclesStart(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+/*******************************************************************************
+  @func    : DYPortSTM32_Cycles
+  @param   : void
+  @return  : uint32_t
+  @date	   : 16.10.26
+  @brief   : CPU cycles, the DYTrace_t clock at SystemCoreClock Hz.
+********************************************************************************/
+uint32_t DYPortSTM32_Cycles(void) {
+    return DWT->CYCCNT;
+}
+/*******************************************************************************
+  @func    : DYPortSTM32_ItmOut
+  @param   : void *ctx, const uint8_t *data, uint16_t len
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Dump sink on ITM stimulus port 0, read over SWO by the debugger.
+             Drops the bytes when no debugger enabled the port.
+********************************************************************************/
+void DYPortSTM32_ItmOut(void *ctx, const uint8_t *data, uint16_t len) {
+    (void)ctx;
+    for (uint16_t i = 0; i < len; i++) {
+        ITM_SendChar(data[i]);
+    }
+}
+/*******************************************************************************
+  @func    : DYPortSTM32_UartOut
+  @param   : void *ctx, const uint8_t *data, uint16_t len
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Dump sink on a debug UART, `ctx` is its UART_HandleTypeDef.
+********************************************************************************/
+void DYPortSTM32_UartOut(void *ctx, const uint8_t *data, uint16_t len) {
+    HAL_UART_Transmit((UART_HandleTypeDef *)ctx, (uint8_t *)data, len, DY_TRACE_OUT_TIMEOUT);
+}
@@ -0,0 +1,267 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_RTOS.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 FreeRTOS driver task of a driver instance, built with DY_RTOS=1.
+********************************************************************************/
+/************************************INCLUDES***********************************/
+#include <string.h>
+
+#include "DYPlayer_RTOS.h"
+
+#if DY_RTOS
+
+#include "DYPlayer_Frame.h"
+
+#define RTOS_TAG_SHIFT      24      /* Notification value: tag << 24 |         */
+#define RTOS_STATUS_SHIFT   16      /* status << 16 | value                    */
+
+
+/*******************************************************************************
+  @func    : notifyClient
+  @param   : void *ctx, DYAsyncStatus_t status, uint16_t value
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Async completion callback, wakes the waiting client task with
+             the tag of its message and the result in its notification value,
+             then frees the waiter `ctx`.
+********************************************************************************/
+static void notifyClient(void *ctx, DYAsyncStatus_t status, uint16_t value) {
+    DYRtosWaiter_t *waiter = (DYRtosWaiter_t *)ctx;
+
+    xTaskNotify(waiter->client, ((uint32_t)waiter->tag << RTOS_TAG_SHIFT)
+                | ((uint32_t)status << RTOS_STATUS_SHIFT) | value, eSetValueWithOverwrite);
+    waiter->client = NULL;
+}
+/*******************************************************************************
+  @func    : takeWaiter
+  @param   : DYRtos_t *rtos, const DYRtosMsg_t *msg
+  @return  : DYRtosWaiter_t *
+  @date	   : 16.10.26
+  @brief   : Free waiter for the client of `msg`, NULL when all are in use.
+             There are as many as async queue entries, so one is free
+             whenever DYAsync_Submit() has room.
+********************************************************************************/
+static DYRtosWaiter_t *takeWaiter(DYRtos_t *rtos, const DYRtosMsg_t *msg) {
+    for (uint8_t i = 0; i < DY_ASYNC_QUEUE_LEN; i++) {
+        DYRtosWaiter_t *waiter = &rtos->waiters[i];
+
+        if (waiter->client == NULL) {
+            waiter->client = msg->client;
+            waiter->tag    = msg->tag;
+            return waiter;
+        }
+    }
+    return NULL;
+}
+/*******************************************************************************
+  @func    : pass
+  @param   : DYRtos_t *rtos
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Move client messages to the async queue while it has room. A
+             message that does not fit is held and tried again next tick, the
+             clients block in xQueueSend() meanwhile.
+********************************************************************************/
+static void pass(DYRtos_t *rtos) {
+    for (;;) {
+        if (!rtos->holding) {
+            if (xQueueReceive(rtos->queue, &rtos->held, 0) != pdPASS) {
+                return;
+            }
+            rtos->holding = true;
+        }
+
+        DYRtosMsg_t    *msg    = &rtos->held;
+        DYRtosWaiter_t *waiter = NULL;
+
+        if (msg->client != NULL) {
+            waiter = takeWaiter(rtos, msg);
+            if (waiter == NULL) {
+                return;
+            }
+        }
+        if (!DYAsync_Submit(&rtos->async, &msg->frame[0], msg->len, msg->response,
+                            (waiter != NULL) ? notifyClient : NULL, waiter, NULL)) {
+            if (waiter != NULL) {
+                waiter->client = NULL;
+            }
+            return;
+        }
+        rtos->holding = false;
+        rtos->messages++;
+    }
+}
+/*******************************************************************************
+  @func    : driverTask
+  @param   : void *param
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Only task touching the instance and its UART. Sleeps until a
+             client message or received bytes, every DY_RTOS_TICK_MS while
+             commands are pending.
+********************************************************************************/
+static void driverTask(void *param) {
+    DYRtos_t             *rtos   = (DYRtos_t *)param;
+    DYPlayer_t           *player = rtos->player;
+    const DYTransport_st *io     = player->transport;
+
+    for (;;) {
+        bool busy = rtos->holding || (DYAsync_Pending(&rtos->async) > 0);
+
+        ulTaskNotifyTake(pdTRUE, busy ? pdMS_TO_TICKS(DY_RTOS_TICK_MS) : portMAX_DELAY);
+        pass(rtos);
+        DYPlayer_Process(player, io->now(player->ctx));
+    }
+}
+/*******************************************************************************
+  @func    : DYRtos_Start
+  @param   : DYRtos_t *rtos, DYPlayer_t *player
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Async queue on an initialised instance and its driver task.
+             From here on only the driver task may use `player`. False when
+             the queue or the task could not be created.
+********************************************************************************/
+bool DYRtos_Start(DYRtos_t *rtos, DYPlayer_t *player) {
+    memset(rtos, 0, sizeof(*rtos));
+    rtos->player = player;
+    DYAsync_Init(&rtos->async, player);
+
+    rtos->queue = xQueueCreate(DY_RTOS_QUEUE_LEN, sizeof(DYRtosMsg_t));
+    if (rtos->queue == NULL) {
+        return false;
+    }
+    return xTaskCreate(driverTask, "DYPlayer", DY_RTOS_STACK, rtos, DY_RTOS_PRIORITY,
+                       &rtos->task) == pdPASS;
+}
+/*******************************************************************************
+  @func    : DYRtos_Submit
+  @param   : DYRtos_t *rtos, const uint8_t *frame, uint8_t len, uint8_t response,
+             uint16_t *value, TickType_t wait
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Hand a frame to the driver task, waiting up to `wait` for room.
+             With `value` NULL it returns once queued. Otherwise the caller
+             blocks until the frame is sent, for a query until the answer
+             opcode `response` came back into `value` or the query timed out,
+             at most DY_RTOS_ANSWER_MS. False when not queued, sent or
+             answered.
+********************************************************************************/
+bool DYRtos_Submit(DYRtos_t *rtos, const uint8_t *frame, uint8_t len, uint8_t response,
+                   uint16_t *value, TickType_t wait) {
+    DYRtosMsg_t msg;
+    uint32_t    result;
+    TickType_t  start;
+    TickType_t  limit;
+    TickType_t  waited;
+
+    if ((len == 0) || (len > DY_ASYNC_FRAME_MAX)) {
+        return false;
+    }
+    memcpy(&msg.frame[0], frame, len);
+    msg.len      = len;
+    msg.response = response;
+    msg.client   = (value != NULL) ? xTaskGetCurrentTaskHandle() : NULL;
+
+    taskENTER_CRITICAL();
+    msg.tag = ++rtos->tag;
+    taskEXIT_CRITICAL();
+
+    if (value != NULL) {
+        /* A late result of an earlier, timed out call must not count. */
+        xTaskNotifyStateClear(NULL);
+        ulTaskNotifyValueClear(NULL, UINT32_MAX);
+    }
+    if (xQueueSend(rtos->queue, &msg, wait) != pdPASS) {
+        return false;
+    }
+    xTaskNotifyGive(rtos->task);
+    if (value == NULL) {
+        return true;
+    }
+
+    start  = xTaskGetTickCount();
+    limit  = pdMS_TO_TICKS(DY_RTOS_ANSWER_MS(rtos->async.retries));
+    waited = 0;
+    do {
+        if (xTaskNotifyWait(0, UINT32_MAX, &result, limit - waited) != pdPASS) {
+            return false;
+        }
+        if ((uint8_t)(result >> RTOS_TAG_SHIFT) == msg.tag) {
+            *value = (uint16_t)result;
+            return (DYAsyncStatus_t)((result >> RTOS_STATUS_SHIFT) & 0xFFU) == DY_ASYNC_DONE;
+        }
+        waited = xTaskGetTickCount() - start;
+    } while (waited < limit);
+
+    return false;
+}
+/*******************************************************************************
+  @func    : DYRtos_Control
+  @param   : DYRtos_t *rtos, uint8_t index, uint16_t *value, TickType_t wait
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : DYRtos_Submit() of a fixed row of controlCommands[], e.g.
+             QCURRENTSONG_CMD with the answer in `value`.
+********************************************************************************/
+bool DYRtos_Control(DYRtos_t *rtos, uint8_t index, uint16_t *value, TickType_t wait) {
+    if (index >= SETVOLUME_CMD) {
+        return false;
+    }
+
+    const uint8_t *row      = &controlCommands[index][0];
+    uint8_t        response = (index >= QPLAY_CMD) ? row[CMD_OPCODE_INDEX] : 0;
+
+    return DYRtos_Submit(rtos, row, LENGTHOF_COMMANDS + LENGTHOF_CRC, response, value, wait);
+}
+/*******************************************************************************
+  @func    : DYRtos_SetVolume
+  @param   : DYRtos_t *rtos, uint8_t volume, TickType_t wait
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : setVolume() through the driver task, returns once queued.
+********************************************************************************/
+bool DYRtos_SetVolume(DYRtos_t *rtos, uint8_t volume, TickType_t wait) {
+    DYFrame_t frame;
+
+    DYFrame_Begin(&frame, controlCommands[SETVOLUME_CMD][CMD_OPCODE_INDEX]);
+    DYFrame_PutByte(&frame, volume);
+    return DYRtos_Submit(rtos, &frame.data[0], DYFrame_End(&frame), 0, NULL, wait);
+}
+/*******************************************************************************
+  @func    : DYRtos_PlaySpecified
+  @param   : DYRtos_t *rtos, uint16_t number, TickType_t wait
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : playSpecified() through the driver task, returns once queued.
+********************************************************************************/
+bool DYRtos_PlaySpecified(DYRtos_t *rtos, uint16_t number, TickType_t wait) {
+    DYFrame_t frame;
+
+    DYFrame_Begin(&frame, controlCommands[SPECIFIEDSONG_CMD][CMD_OPCODE_INDEX]);
+    DYFrame_PutWord(&frame, number);
+    return DYRtos_Submit(rtos, &frame.data[0], DYFrame_End(&frame), 0, NULL, wait);
+}
+/*******************************************************************************
+  @func    : DYRtos_WakeFromISR
+  @param   : DYRtos_t *rtos
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Call from the UART RX interrupt (idle line, half/full transfer).
+             Only wakes the driver task, which reads the received frames
+             itself.
+********************************************************************************/
+void DYRtos_WakeFromISR(DYRtos_t *rtos) {
+    BaseType_t woken = pdFALSE;
+
+    if (rtos->task != NULL) {
+        vTaskNotifyGiveFromISR(rtos->task, &woken);
+    }
+    portYIELD_FROM_ISR(woken);
+}
+
+#endif /* DY_RTOS */
@@ -0,0 +1,113 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_Ring.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Lock-free single producer / single consumer byte ring.
+********************************************************************************/
+
+/************************************INCLUDES***********************************/
+#include "DYPlayer_Ring.h"
+
+
+/*******************************************************************************
+  @func    : DYRing_Init
+  @param   : DYRing_t *ring, uint8_t *buffer, uint16_t size
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Attach a storage buffer to the ring and empty it. `size` has to be
+             a power of two.
+********************************************************************************/
+void DYRing_Init(DYRing_t *ring, uint8_t *buffer, uint16_t size) {
+    ring->buffer = buffer;
+    ring->size   = size;
+    ring->head   = 0;
+    ring->tail   = 0;
+}
+/*******************************************************************************
+  @func    : DYRing_Count
+  @param   : const DYRing_t *ring
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Number of bytes waiting to be consumed.
+********************************************************************************/
+uint16_t DYRing_Count(const DYRing_t *ring) {
+    return (uint16_t)(ring->head - ring->tail);
+}
+/*******************************************************************************
+  @func    : DYRing_Space
+  @param   : const DYRing_t *ring
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Number of bytes that can still be written.
+********************************************************************************/
+uint16_t DYRing_Space(const DYRing_t *ring) {
+    return (uint16_t)(ring->size - DYRing_Count(ring));
+}
+/*******************************************************************************
+  @func    : DYRing_Write
+  @param   : DYRing_t *ring, const uint8_t *data, uint16_t len
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Producer side. Copies the whole buffer or nothing at all, so a
+             command frame is never split by a full ring.
+********************************************************************************/
+bool DYRing_Write(DYRing_t *ring, const uint8_t *data, uint16_t len) {
+    if (DYRing_Space(ring) < len) {
+        return false;
+    }
+
+    uint16_t head = ring->head;
+    uint16_t mask = ring->size - 1;
+    for (uint16_t i = 0; i < len; i++) {
+        ring->buffer[(uint16_t)(head + i) & mask] = data[i];
+    }
+    /* Bytes have to be visible before the consumer sees the new head. */
+    DY_RING_BARRIER();
+    ring->head = head + len;
+    return true;
+}
+/*******************************************************************************
+  @func    : DYRing_Read
+  @param   : DYRing_t *ring, uint8_t *data, uint16_t len
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Consumer side. Reads up to `len` bytes, returns the amount read.
+********************************************************************************/
+uint16_t DYRing_Read(DYRing_t *ring, uint8_t *data, uint16_t len) {
+    uint16_t count = DYRing_Count(ring);
+    if (len > count) {
+        len = count;
+    }
+
+    uint16_t tail = ring->tail;
+    uint16_t mask = ring->size - 1;
+    /* Do not read the bytes before the head that published them. */
+    DY_RING_BARRIER();
+    for (uint16_t i = 0; i < len; i++) {
+        data[i] = ring->buffer[(uint16_t)(tail + i) & mask];
+    }
+    DY_RING_BARRIER();
+    ring->tail = tail + len;
+    return len;
+}
+/*******************************************************************************
+  @func    : DYRing_Get
+  @param   : DYRing_t *ring, uint8_t *byte
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Consumer side, single byte variant for the TXE interrupt.
+********************************************************************************/
+bool DYRing_Get(DYRing_t *ring, uint8_t *byte) {
+    uint16_t tail = ring->tail;
+    if (ring->head == tail) {
+        return false;
+    }
+    DY_RING_BARRIER();
+    *byte = ring->buffer[tail & (ring->size - 1)];
+    DY_RING_BARRIER();
+    ring->tail = tail + 1;
+    return true;
+}
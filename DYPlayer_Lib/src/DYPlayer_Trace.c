@@ -0,0 +1,269 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_Trace.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Wire trace ring and the tracing transport.
+********************************************************************************/
+/************************************DEFINES***********************************/
+
+#define TRACE_MASK          (DY_TRACE_SIZE - 1)
+
+/************************************INCLUDES***********************************/
+#include <string.h>
+
+#include "DYPlayer_Trace.h"
+
+#if (DY_TRACE_SIZE & TRACE_MASK) != 0 || DY_TRACE_SIZE < DY_TRACE_RECORD_MAX
+#error "DY_TRACE_SIZE must be a power of 2 that holds the longest record"
+#endif
+
+
+/*******************************************************************************
+  @func    : DYTrace_Init
+  @param   : DYTrace_t *trace, const DYTransport_st *transport, void *ctx,
+             DYTrace_Clock_t clock, uint32_t clockHz
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Empty, enabled recorder over a ready transport. Hand it to
+             DYPlayer_Init() with `DYTransport_Trace`.
+********************************************************************************/
+void DYTrace_Init(DYTrace_t *trace, const DYTransport_st *transport, void *ctx,
+                  DYTrace_Clock_t clock, uint32_t clockHz) {
+    memset(trace, 0, sizeof(*trace));
+    trace->transport = transport;
+    trace->ctx       = ctx;
+    trace->clock     = clock;
+    trace->clockHz   = clockHz;
+    trace->enabled   = true;
+}
+/*******************************************************************************
+  @func    : DYTrace_Enable
+  @param   : DYTrace_t *trace, bool enable
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Pause or resume recording, the traffic passes either way.
+********************************************************************************/
+void DYTrace_Enable(DYTrace_t *trace, bool enable) {
+    trace->enabled = enable;
+}
+/*******************************************************************************
+  @func    : DYTrace_Clear
+  @param   : DYTrace_t *trace
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Drop every record.
+********************************************************************************/
+void DYTrace_Clear(DYTrace_t *trace) {
+    trace->head    = 0;
+    trace->tail    = 0;
+    trace->dropped = 0;
+}
+/*******************************************************************************
+  @func    : maskIrq
+  @param   : void
+  @return  : uint32_t
+  @date	   : 16.10.26
+  @brief   : Mask interrupts on Cortex-M, returns PRIMASK before. Nothing on
+             other targets, every record then comes from one context.
+********************************************************************************/
+static inline uint32_t maskIrq(void) {
+#if defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
+    uint32_t primask;
+
+    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (primask) :: "memory");
+    return primask;
+#else
+    return 0;
+#endif
+}
+/*******************************************************************************
+  @func    : unmaskIrq
+  @param   : uint32_t primask
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Restore PRIMASK from maskIrq().
+********************************************************************************/
+static inline void unmaskIrq(uint32_t primask) {
+#if defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
+    __asm volatile ("msr primask, %0" :: "r" (primask) : "memory");
+#else
+    (void)primask;
+#endif
+}
+/*******************************************************************************
+  @func    : put
+  @param   : DYTrace_t *trace, uint8_t byte
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Append one byte, room was made before.
+********************************************************************************/
+static inline void put(DYTrace_t *trace, uint8_t byte) {
+    trace->ring[trace->head & TRACE_MASK] = byte;
+    trace->head++;
+}
+/*******************************************************************************
+  @func    : append
+  @param   : DYTrace_t *trace, uint8_t header, uint32_t stamp,
+             const uint8_t *data, uint8_t len
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Drop the oldest records until the new one fits, then write it.
+********************************************************************************/
+static void append(DYTrace_t *trace, uint8_t header, uint32_t stamp, const uint8_t *data, uint8_t len) {
+    uint32_t size = 1U + 4U + len;
+
+    while ((DY_TRACE_SIZE - (trace->head - trace->tail)) < size) {
+        trace->tail += 1U + 4U + (trace->ring[trace->tail & TRACE_MASK] & DY_TRACE_LEN_MASK);
+        trace->dropped++;
+    }
+
+    put(trace, header);
+    put(trace, (uint8_t)stamp);
+    put(trace, (uint8_t)(stamp >> 8));
+    put(trace, (uint8_t)(stamp >> 16));
+    put(trace, (uint8_t)(stamp >> 24));
+    for (uint8_t i = 0; i < len; i++) {
+        put(trace, data[i]);
+    }
+}
+/*******************************************************************************
+  @func    : DYTrace_Record
+  @param   : DYTrace_t *trace, bool rx, const uint8_t *data, uint16_t len
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Log `len` bytes of one direction under the current time stamp.
+             More than DY_TRACE_LEN_MASK bytes take several records. Each
+             record is written with interrupts masked on Cortex-M, so
+             DYTrace_RecordRaw() may run from the UART interrupt.
+********************************************************************************/
+void DYTrace_Record(DYTrace_t *trace, bool rx, const uint8_t *data, uint16_t len) {
+    if (!trace->enabled || (len == 0)) {
+        return;
+    }
+
+    uint32_t stamp = trace->clock();
+
+    while (len > 0) {
+        uint8_t  n       = (len > DY_TRACE_LEN_MASK) ? DY_TRACE_LEN_MASK : (uint8_t)len;
+        uint32_t primask = maskIrq();
+
+        append(trace, (uint8_t)((rx ? DY_TRACE_RX : 0) | n), stamp, data, n);
+        unmaskIrq(primask);
+        data += n;
+        len  -= n;
+    }
+}
+/*******************************************************************************
+  @func    : DYTrace_RecordRaw
+  @param   : DYTrace_t *trace, const uint8_t *data, uint16_t len
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Log received bytes as they came off the wire, e.g. from the
+             rxCallback of a DMA receive port, whose reads only hand over
+             checked frames. From the first call on reads are no longer
+             logged, so answers are not recorded twice.
+********************************************************************************/
+void DYTrace_RecordRaw(DYTrace_t *trace, const uint8_t *data, uint16_t len) {
+    trace->rawRx = true;
+    DYTrace_Record(trace, true, data, len);
+}
+/*******************************************************************************
+  @func    : DYTrace_Dump
+  @param   : const DYTrace_t *trace, DYTrace_Out_t out, void *ctx
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Stream the header and every record, oldest first, to `out`.
+             Pause recording around it if the driver or DYTrace_RecordRaw()
+             may run meanwhile.
+********************************************************************************/
+void DYTrace_Dump(const DYTrace_t *trace, DYTrace_Out_t out, void *ctx) {
+    uint32_t used = trace->head - trace->tail;
+    uint32_t from = trace->tail & TRACE_MASK;
+    uint8_t  header[DY_TRACE_HEADER_LEN] = { 'D', 'Y', 'T', 'R', DY_TRACE_VERSION, 0, 0, 0 };
+    uint32_t fields[3] = { trace->clockHz, trace->dropped, used };
+
+    for (uint8_t i = 0; i < 3; i++) {
+        header[8 + (i * 4) + 0] = (uint8_t)fields[i];
+        header[8 + (i * 4) + 1] = (uint8_t)(fields[i] >> 8);
+        header[8 + (i * 4) + 2] = (uint8_t)(fields[i] >> 16);
+        header[8 + (i * 4) + 3] = (uint8_t)(fields[i] >> 24);
+    }
+    out(ctx, &header[0], sizeof(header));
+
+    if ((from + used) > DY_TRACE_SIZE) {
+        out(ctx, &trace->ring[from], (uint16_t)(DY_TRACE_SIZE - from));
+        out(ctx, &trace->ring[0], (uint16_t)(used - (DY_TRACE_SIZE - from)));
+    } else if (used > 0) {
+        out(ctx, &trace->ring[from], (uint16_t)used);
+    }
+}
+
+/******************************************************************************/
+
+/*******************************************************************************
+  @func    : traceWrite
+  @param   : void *ctx, const uint8_t *data, uint16_t len
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Write through, log what the transport took.
+********************************************************************************/
+static uint16_t traceWrite(void *ctx, const uint8_t *data, uint16_t len) {
+    DYTrace_t *trace = (DYTrace_t *)ctx;
+    uint16_t   n     = trace->transport->write(trace->ctx, data, len);
+
+    DYTrace_Record(trace, false, data, n);
+    return n;
+}
+/*******************************************************************************
+  @func    : traceRead
+  @param   : void *ctx, uint8_t *buffer, uint16_t len, uint32_t timeout
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Read through, log what came in unless DYTrace_RecordRaw()
+             logs the received bytes.
+********************************************************************************/
+static uint16_t traceRead(void *ctx, uint8_t *buffer, uint16_t len, uint32_t timeout) {
+    DYTrace_t *trace = (DYTrace_t *)ctx;
+    uint16_t   n     = trace->transport->read(trace->ctx, buffer, len, timeout);
+
+    if (!trace->rawRx) {
+        DYTrace_Record(trace, true, buffer, n);
+    }
+    return n;
+}
+/*******************************************************************************
+  @func    : traceNow
+  @param   : void *ctx
+  @return  : uint32_t
+  @date	   : 16.10.26
+  @brief   : Time of the transport underneath.
+********************************************************************************/
+static uint32_t traceNow(void *ctx) {
+    DYTrace_t *trace = (DYTrace_t *)ctx;
+
+    return trace->transport->now(trace->ctx);
+}
+/*******************************************************************************
+  @func    : traceWait
+  @param   : void *ctx, uint32_t us
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Wait of the transport underneath.
+********************************************************************************/
+static void traceWait(void *ctx, uint32_t us) {
+    DYTrace_t *trace = (DYTrace_t *)ctx;
+
+    trace->transport->wait(trace->ctx, us);
+}
+
+/******************************************************************************/
+
+const DYTransport_st DYTransport_Trace = {
+    traceWrite,
+    traceRead,
+    traceNow,
+    traceWait,
+};
@@ -0,0 +1,325 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_UartDMA.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 DMA driven UART transmit and receive paths.
+********************************************************************************/
+
+/************************************INCLUDES***********************************/
+#include <string.h>
+
+#include "DYPlayer_UartDMA.h"
+
+
+/*******************************************************************************
+  @func    : DYPlayer_UartDMA_Start
+  @param   : DYUartDMA_t *port
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Hand the oldest queued buffer to the DMA, caller guarantees no
+             transfer is running. HAL_BUSY (UART still taken, e.g. by a
+             blocking transmit or the RX restart) leaves the buffer queued for
+             DYPlayer_UartDMA_Poll or the next Write to retry and counts it in
+             `stalls`; a buffer the HAL refuses with HAL_ERROR is dropped and
+             counted, then the next one is tried. False when nothing started.
+********************************************************************************/
+static bool DYPlayer_UartDMA_Start(DYUartDMA_t *port) {
+    while (port->tail != port->head) {
+        DYDmaTxDesc_t    *desc = &port->queue[port->tail & (DY_DMA_TX_QUEUE_LEN - 1)];
+        HAL_StatusTypeDef status;
+
+        port->active = true;
+        status       = HAL_UART_Transmit_DMA(port->huart, (uint8_t *)desc->data, desc->len);
+        if (status == HAL_OK) {
+            return true;
+        }
+
+        /* No completion interrupt will come for this buffer. */
+        port->active = false;
+        if (status == HAL_BUSY) {
+            port->stalls++;
+            return false;
+        }
+        port->dropped++;
+        port->tail = port->tail + 1;
+    }
+    return false;
+}
+/*******************************************************************************
+  @func    : DYPlayer_UartDMA_Init
+  @param   : DYUartDMA_t *port, UART_HandleTypeDef *huart
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Bind a DMA transmit port to an initialized UART whose hdmatx is
+             linked. HAL_UART_TxCpltCallback() has to forward to
+             DYPlayer_UartDMA_TxCpltHandler().
+********************************************************************************/
+void DYPlayer_UartDMA_Init(DYUartDMA_t *port, UART_HandleTypeDef *huart) {
+    port->huart      = huart;
+    port->head       = 0;
+    port->tail       = 0;
+    port->active     = false;
+    port->dropped    = 0;
+    port->stalls     = 0;
+    port->txCallback = NULL;
+}
+/*******************************************************************************
+  @func    : DYPlayer_UartDMA_SetTxCallback
+  @param   : DYUartDMA_t *port, DYPlayer_TxCallback_t callback
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Register the completion callback, NULL to disable.
+********************************************************************************/
+void DYPlayer_UartDMA_SetTxCallback(DYUartDMA_t *port, DYPlayer_TxCallback_t callback) {
+    port->txCallback = callback;
+}
+/*******************************************************************************
+  @func    : DYPlayer_UartDMA_Write
+  @param   : DYUartDMA_t *port, const uint8_t *data, uint16_t len
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Queue a buffer and return immediately. Flash buffers are sent in
+             place, anything else is copied to a slot first so the caller may
+             release it. Returns false when the queue is full or a RAM buffer
+             does not fit in a slot.
+********************************************************************************/
+bool DYPlayer_UartDMA_Write(DYUartDMA_t *port, const uint8_t *data, uint16_t len) {
+    uint8_t head = port->head;
+
+    if (((uint8_t)(head - port->tail) >= DY_DMA_TX_QUEUE_LEN) && !port->active) {
+        /* Stalled by a failed start, try it again before giving up. */
+        DYPlayer_UartDMA_Start(port);
+    }
+    if ((uint8_t)(head - port->tail) >= DY_DMA_TX_QUEUE_LEN) {
+        return false;
+    }
+
+    DYDmaTxDesc_t *desc = &port->queue[head & (DY_DMA_TX_QUEUE_LEN - 1)];
+    if (DY_DMA_IS_FLASH(data)) {
+        desc->data = data;
+    } else {
+        if (len > DY_DMA_TX_SLOT_SIZE) {
+            return false;
+        }
+        memcpy(&port->slot[head & (DY_DMA_TX_QUEUE_LEN - 1)][0], data, len);
+        desc->data = &port->slot[head & (DY_DMA_TX_QUEUE_LEN - 1)][0];
+    }
+    desc->len = len;
+
+    __DMB();
+    port->head = head + 1;
+
+    /*
+     * The completion IRQ only clears `active` after it saw an empty queue or
+     * could not start the next buffer, the new head is already visible here
+     * so the buffer is never left behind.
+     */
+    if (!port->active) {
+        DYPlayer_UartDMA_Start(port);
+    }
+    return true;
+}
+/*******************************************************************************
+  @func    : DYPlayer_UartDMA_Poll
+  @param   : DYUartDMA_t *port
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Start buffers a refused start left queued, so the last frame
+             of a burst does not wait for a next Write that never comes.
+             Call from the context that writes; the STM32 transports do it
+             on every read and time stamp.
+********************************************************************************/
+void DYPlayer_UartDMA_Poll(DYUartDMA_t *port) {
+    if (!port->active && (port->tail != port->head)) {
+        DYPlayer_UartDMA_Start(port);
+    }
+}
+/*******************************************************************************
+  @func    : DYPlayer_UartDMA_Busy
+  @param   : DYUartDMA_t *port
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : True while a transfer is running. Buffers left queued by a
+             failed start go out with DYPlayer_UartDMA_Poll or the next Write.
+********************************************************************************/
+bool DYPlayer_UartDMA_Busy(DYUartDMA_t *port) {
+    return port->active;
+}
+/*******************************************************************************
+  @func    : DYPlayer_UartDMA_TxCpltHandler
+  @param   : DYUartDMA_t *port, UART_HandleTypeDef *huart
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Call from HAL_UART_TxCpltCallback(). Reports the finished buffer
+             and chains the next queued one.
+********************************************************************************/
+void DYPlayer_UartDMA_TxCpltHandler(DYUartDMA_t *port, UART_HandleTypeDef *huart) {
+    if (huart != port->huart) {
+        return;
+    }
+
+    DYDmaTxDesc_t *desc = &port->queue[port->tail & (DY_DMA_TX_QUEUE_LEN - 1)];
+    if (port->txCallback != NULL) {
+        port->txCallback(desc->data, desc->len);
+    }
+
+    port->tail = port->tail + 1;
+    if (!DYPlayer_UartDMA_Start(port)) {
+        port->active = false;
+    }
+}
+/*******************************************************************************
+  @func    : DYPlayer_UartDMA_RxPush
+  @param   : DYUartDMARx_t *port, const uint8_t *data, uint16_t len
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Parse a chunk of the DMA buffer, every complete frame goes to the
+             queue; hand the raw bytes to the listener. A full queue drops the
+             new frame, counted in `frames.dropped`.
+********************************************************************************/
+static void DYPlayer_UartDMA_RxPush(DYUartDMARx_t *port, const uint8_t *data, uint16_t len) {
+    if (len == 0U) {
+        return;
+    }
+    for (uint16_t i = 0; i < len; i++) {
+        if (DYParser_Feed(&port->parser, data[i])) {
+            DYRxQueue_Push(&port->frames, &port->parser.frame[0], port->parser.len);
+        }
+    }
+    if (port->rxCallback != NULL) {
+        port->rxCallback(data, len);
+    }
+}
+/*******************************************************************************
+  @func    : DYPlayer_UartDMA_RxRestart
+  @param   : DYUartDMARx_t *port
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : (Re)arm the circular reception from the start of the buffer. The
+             HAL refuses with HAL_BUSY while another context holds the UART
+             lock, e.g. a DMA transmit being started; the restart is then
+             left pending for DYPlayer_UartDMA_Read and counted.
+********************************************************************************/
+static void DYPlayer_UartDMA_RxRestart(DYUartDMARx_t *port) {
+    port->rxPos = 0;
+    if (HAL_UARTEx_ReceiveToIdle_DMA(port->huart, &port->dmaBuffer[0], DY_DMA_RX_BUFFER_SIZE) == HAL_OK) {
+        port->restart = false;
+    } else {
+        port->restart = true;
+        port->restartFails++;
+    }
+}
+/*******************************************************************************
+  @func    : DYPlayer_UartDMA_RxStart
+  @param   : DYUartDMARx_t *port, UART_HandleTypeDef *huart
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Start the background receiver. hdmarx has to be in circular mode,
+             HAL_UARTEx_RxEventCallback() has to forward to
+             DYPlayer_UartDMA_RxEventHandler() and HAL_UART_ErrorCallback() to
+             DYPlayer_UartDMA_RxErrorHandler().
+********************************************************************************/
+void DYPlayer_UartDMA_RxStart(DYUartDMARx_t *port, UART_HandleTypeDef *huart) {
+    port->huart        = huart;
+    port->readPos      = 0;
+    port->restartFails = 0;
+    DYParser_Init(&port->parser);
+    DYRxQueue_Init(&port->frames);
+
+    DYPlayer_UartDMA_RxRestart(port);
+}
+/*******************************************************************************
+  @func    : DYPlayer_UartDMA_SetRxCallback
+  @param   : DYUartDMARx_t *port, DYPlayer_RxCallback_t callback
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Register a listener for received bytes, NULL to disable.
+********************************************************************************/
+void DYPlayer_UartDMA_SetRxCallback(DYUartDMARx_t *port, DYPlayer_RxCallback_t callback) {
+    port->rxCallback = callback;
+}
+/*******************************************************************************
+  @func    : DYPlayer_UartDMA_Read
+  @param   : DYUartDMARx_t *port, uint8_t *buffer, uint16_t len
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Take up to `len` bytes of the frames received so far, never
+             waits. Only checked frames come out; one too long for `buffer`
+             continues on the next call. Retries a restart of the reception
+             the HAL refused before.
+********************************************************************************/
+uint16_t DYPlayer_UartDMA_Read(DYUartDMARx_t *port, uint8_t *buffer, uint16_t len) {
+    const DYRxFrame_t *frame;
+    uint16_t           n = 0;
+
+    /* Reception is stopped, no event or error interrupt can come in between. */
+    if (port->restart && (port->huart->RxState == HAL_UART_STATE_READY)) {
+        DYPlayer_UartDMA_RxRestart(port);
+    }
+
+    while ((n < len) && ((frame = DYRxQueue_Peek(&port->frames)) != NULL)) {
+        uint8_t take = frame->len - port->readPos;
+
+        if (take > (len - n)) {
+            take = (uint8_t)(len - n);
+        }
+        memcpy(&buffer[n], &frame->data[port->readPos], take);
+        n             += take;
+        port->readPos += take;
+        if (port->readPos == frame->len) {
+            port->readPos = 0;
+            DYRxQueue_Release(&port->frames);
+        }
+    }
+    return n;
+}
+/*******************************************************************************
+  @func    : DYPlayer_UartDMA_RxEventHandler
+  @param   : DYUartDMARx_t *port, UART_HandleTypeDef *huart, uint16_t pos
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Call from HAL_UARTEx_RxEventCallback(). `pos` is the DMA write
+             index reported by the HAL on IDLE, half and full transfer events.
+********************************************************************************/
+void DYPlayer_UartDMA_RxEventHandler(DYUartDMARx_t *port, UART_HandleTypeDef *huart, uint16_t pos) {
+    if (huart != port->huart) {
+        return;
+    }
+
+    if (pos > port->rxPos) {
+        DYPlayer_UartDMA_RxPush(port, &port->dmaBuffer[port->rxPos], pos - port->rxPos);
+    } else if (pos < port->rxPos) {
+        /* DMA wrapped around, take the tail and then the start of the buffer. */
+        DYPlayer_UartDMA_RxPush(port, &port->dmaBuffer[port->rxPos], DY_DMA_RX_BUFFER_SIZE - port->rxPos);
+        DYPlayer_UartDMA_RxPush(port, &port->dmaBuffer[0], pos);
+    }
+
+    port->rxPos = (pos >= DY_DMA_RX_BUFFER_SIZE) ? 0 : pos;
+}
+/*******************************************************************************
+  @func    : DYPlayer_UartDMA_RxErrorHandler
+  @param   : DYUartDMARx_t *port, UART_HandleTypeDef *huart
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Call from HAL_UART_ErrorCallback(). The HAL stops the DMA on
+             overrun or noise errors, restart it so reception never ends.
+             Bytes the DMA wrote since the last event are taken first, NDTR
+             still holds the position after the stream was stopped. A restart
+             the HAL refuses is retried by DYPlayer_UartDMA_Read.
+********************************************************************************/
+void DYPlayer_UartDMA_RxErrorHandler(DYUartDMARx_t *port, UART_HandleTypeDef *huart) {
+    if (huart != port->huart) {
+        return;
+    }
+
+    uint16_t pos = DY_DMA_RX_BUFFER_SIZE - (uint16_t)__HAL_DMA_GET_COUNTER(huart->hdmarx);
+
+    DYPlayer_UartDMA_RxEventHandler(port, huart, pos);
+
+    if (huart->RxState == HAL_UART_STATE_READY) {
+        DYPlayer_UartDMA_RxRestart(port);
+    }
+}
@@ -0,0 +1,105 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_UartIT.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Interrupt driven, non-blocking UART transmit path.
+********************************************************************************/
+
+/************************************INCLUDES***********************************/
+#include "DYPlayer_UartIT.h"
+
+
+/*******************************************************************************
+  @func    : DYPlayer_UartIT_Init
+  @param   : DYUartIT_t *port, UART_HandleTypeDef *huart
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Bind a transmit port to an already initialized UART. The UART IRQ
+             has to be enabled in the NVIC and forward to
+             DYPlayer_UartIT_IRQHandler().
+********************************************************************************/
+void DYPlayer_UartIT_Init(DYUartIT_t *port, UART_HandleTypeDef *huart) {
+    port->huart = huart;
+    port->busy  = false;
+    DYRing_Init(&port->tx, &port->txBuffer[0], DY_TX_RING_SIZE);
+}
+/*******************************************************************************
+  @func    : DYPlayer_UartIT_Write
+  @param   : DYUartIT_t *port, const uint8_t *data, uint16_t len
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Queue bytes for transmission and return immediately. Returns false
+             without queueing anything when the ring has no room for the whole
+             buffer.
+********************************************************************************/
+bool DYPlayer_UartIT_Write(DYUartIT_t *port, const uint8_t *data, uint16_t len) {
+    if (!DYRing_Write(&port->tx, data, len)) {
+        return false;
+    }
+
+    port->busy = true;
+    /* TXE is already set on an idle UART, so this fires the IRQ right away. */
+    ATOMIC_SET_BIT(port->huart->Instance->CR1, USART_CR1_TXEIE);
+    return true;
+}
+/*******************************************************************************
+  @func    : DYPlayer_UartIT_Busy
+  @param   : DYUartIT_t *port
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : True while bytes are still queued or shifting out of the UART.
+********************************************************************************/
+bool DYPlayer_UartIT_Busy(DYUartIT_t *port) {
+    return port->busy;
+}
+/*******************************************************************************
+  @func    : DYPlayer_UartIT_IRQHandler
+  @param   : DYUartIT_t *port
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Call from the UARTx_IRQHandler before HAL_UART_IRQHandler(). Feeds
+             one byte per TXE and switches to TC once the ring is drained.
+             TCIE is never left set with TC pending: the HAL would take that
+             as the end of its own transmit and raise a false
+             HAL_UART_TxCpltCallback(). Don't use the HAL TX interrupt
+             calls (HAL_UART_Transmit_IT) on the same UART.
+********************************************************************************/
+void DYPlayer_UartIT_IRQHandler(DYUartIT_t *port) {
+    if (port->huart == NULL) {
+        return;     /* First write not done yet, IRQ is from the HAL side. */
+    }
+
+    USART_TypeDef *uart = port->huart->Instance;
+    uint32_t       sr   = READ_REG(uart->SR);
+    uint32_t       cr1  = READ_REG(uart->CR1);
+
+    if (((sr & USART_SR_TXE) != 0U) && ((cr1 & USART_CR1_TXEIE) != 0U)) {
+        uint8_t byte;
+        if (DYRing_Get(&port->tx, &byte)) {
+            uart->DR = byte;
+        } else if ((READ_REG(uart->SR) & USART_SR_TC) != 0U) {
+            /* Late interrupt, the last stop bit already left. */
+            ATOMIC_CLEAR_BIT(uart->CR1, USART_CR1_TXEIE);
+            port->busy = false;
+            return;
+        } else {
+            /* Nothing left, wait for the last stop bit before going idle. */
+            ATOMIC_CLEAR_BIT(uart->CR1, USART_CR1_TXEIE);
+            ATOMIC_SET_BIT(uart->CR1, USART_CR1_TCIE);
+            /* TC may have risen meanwhile, take it here and not in the HAL. */
+            sr  = READ_REG(uart->SR);
+            cr1 = READ_REG(uart->CR1);
+        }
+    }
+
+    if (((sr & USART_SR_TC) != 0U) && ((cr1 & USART_CR1_TCIE) != 0U)) {
+        ATOMIC_CLEAR_BIT(uart->CR1, USART_CR1_TCIE);
+        /* A writer may have queued more bytes after TXEIE was dropped. */
+        if (DYRing_Count(&port->tx) == 0U) {
+            port->busy = false;
+        }
+    }
+}
@@ -7,17 +7,23 @@
   * @rev     V1.0.0
   * @brief	 UART Control of DY-XXXX mp3 modules C Driver
 ********************************************************************************/
-/************************************DEFINES***********************************/
+#ifndef DYPLAYER_H
+#define DYPLAYER_H
 
-/*************************** NOTICE: DONT FORGET TO*****************************/
-/*  extern UART_HandleTypeDef huartx; --> main.h file						   */
-/*******************************************************************************/
+/************************************DEFINES***********************************/
 
+#ifndef DY_RX_TIMEOUT
+#define DY_RX_TIMEOUT       100 /* ms, longest wait for a query response.         */
+#endif
 
-#ifndef DY_PATHS_IN_HEAP
-#define DY_PATH_LEN 40
+#ifndef DY_TX_TIMEOUT
+#define DY_TX_TIMEOUT       100 /* ms, longest wait for room in the transport.    */
 #endif
 
+#define DY_TX_RETRY         1000 /* us, back off while the transport is full.     */
+
+#define DY_VOLUME_MAX       30   /* Highest volume step of the module.            */
+
 /************************************INCLUDES***********************************/
 
 #include <stdint.h>
@@ -26,7 +32,10 @@
 #include <stdbool.h>
 #include <string.h>
 
-#include "main.h"
+#include "DYPlayer_Transport.h"
+#include "DYPlayer_Frame.h"
+#include "DYPlayer_Parser.h"
+#include "DYPlayer_Busy.h"
 
 
 
@@ -106,10 +115,132 @@ typedef enum PreviousDirSound
 
 
 
+/**
+ * Bits of `DYStatus_t.valid`, set for every field the module answered.
+ */
+#define DY_STATUS_STATE         (1U << 0)
+#define DY_STATUS_DEVICE        (1U << 1)
+#define DY_STATUS_SOUND         (1U << 2)
+#define DY_STATUS_SOUNDCOUNT    (1U << 3)
+#define DY_STATUS_FIRSTINDIR    (1U << 4)
+#define DY_STATUS_SOUNDCOUNTDIR (1U << 5)
+#define DY_STATUS_ALL           0x3FU
+
+/**
+ * Everything the module can be asked about, filled by DYPlayer_Snapshot().
+ * Fields without their `valid` bit keep the getter's failure value.
+ */
+typedef struct
+{
+    play_state_t state;           /* checkPlayState()                           */
+    device_t     device;          /* getPlayingDevice()                         */
+    uint16_t     sound;           /* getPlayingSound()                          */
+    uint16_t     soundCount;      /* getSoundCount()                            */
+    uint16_t     firstInDir;      /* getFirstInDir()                            */
+    uint16_t     soundCountDir;   /* getSoundCountDir()                         */
+    uint8_t      valid;           /* DY_STATUS_* bits                           */
+    uint32_t     elapsedUs;       /* Burst start to last answer or timeout      */
+} DYStatus_t;
+
+/**
+ * Bits of `DYShadow_t.known`, set for every setting sent since DYPlayer_Init().
+ */
+#define DY_SHADOW_VOLUME        (1U << 0)
+#define DY_SHADOW_EQ            (1U << 1)
+#define DY_SHADOW_MODE          (1U << 2)
+#define DY_SHADOW_CYCLES        (1U << 3)
+#define DY_SHADOW_DEVICE        (1U << 4)
+#define DY_SHADOW_STATE         (1U << 5)
+
+/**
+ * Settings last sent to the module. It has no query for most of them, so
+ * this is the only place they can be read back from.
+ */
+typedef struct
+{
+    uint8_t      volume;          /* setVolume(), volumeIncrease/Decrease()     */
+    eq_t         eq;              /* setEq()                                    */
+    play_mode_t  mode;            /* setCycleMode()                             */
+    uint16_t     cycles;          /* setCycleTimes()                            */
+    device_t     device;          /* setPlayingDevice(), getPlayingDevice()     */
+    play_state_t state;           /* pause(), stop(), checkPlayState()          */
+    uint8_t      known;           /* DY_SHADOW_* bits of the fields above       */
+} DYShadow_t;
+
+/*
+ * Non-blocking work attached to an instance, run by DYPlayer_Process().
+ * `now` is transport time in us.
+ */
+typedef void (*DYPlayer_Process_t)(void *ctx, uint32_t now);
+
+/**
+ * Driver instance, binds the API to one module and its transport. Give every
+ * module its own, with its own transport context (UART, TX/RX buffers).
+ * The DYPlayer_ calls name their instance. Calls made through `DYPlayer`
+ * go to the one last given to DYPlayer_Init() or DYPlayer_Use(), a single
+ * global: tasks or modules that must not race on it use the DYPlayer_ calls.
+ */
+typedef struct
+{
+    const DYTransport_st *transport;  /* Backend operations                     */
+    void                 *ctx;        /* Backend context, passed to every op    */
+    DYParser_t            parser;     /* Response framing, handlers may be added */
+    DYShadow_t            shadow;     /* Settings sent to the module            */
+    bool                  suppress;   /* Drop commands the shadow shows are no-ops */
+    uint32_t              savedCommands;  /* Dropped by `suppress`              */
+    uint32_t              savedBytes;     /* Wire bytes they would have taken   */
+    uint32_t              txFrames;       /* Writes the transport took          */
+    uint32_t              txBytes;
+    uint32_t              txDropped;      /* Writes given up after DY_TX_TIMEOUT */
+    uint32_t              rxTimeouts;     /* Queries left without a full answer */
+    const DYBusy_t       *busy;           /* BUSY pin monitor, NULL = none      */
+    DYPlayer_Process_t    process;        /* Set by DYAsync_Init(), NULL = none */
+    void                 *processCtx;
+} DYPlayer_t;
+
 /**
  * Function Declerations
  */
 
+void          DYPlayer_Init(DYPlayer_t *player, const DYTransport_st *transport, void *ctx);
+DYPlayer_t   *DYPlayer_Use(DYPlayer_t *player);
+bool          DYPlayer_Snapshot(DYPlayer_t *player, DYStatus_t *status);
+const DYShadow_t *DYPlayer_Shadow(const DYPlayer_t *player);
+void          DYPlayer_Resync(DYPlayer_t *player);
+void          DYPlayer_SetSuppression(DYPlayer_t *player, bool enable);
+void          DYPlayer_SetBusy(DYPlayer_t *player, const DYBusy_t *busy);
+void          DYPlayer_Process(DYPlayer_t *player, uint32_t now);
+void          DYShadow_Record(DYShadow_t *shadow, const uint8_t *frame);
+void          DYPlayer_Write(DYPlayer_t *player, const uint8_t *buffer, uint8_t len);
+uint8_t       DYPlayer_Read(DYPlayer_t *player, uint8_t *buffer, uint8_t len);
+bool          DYPlayer_GetResponse(DYPlayer_t *player, uint8_t *buffer, uint8_t len, uint8_t opcode);
+play_state_t  DYPlayer_CheckPlayState(DYPlayer_t *player);
+void          DYPlayer_Play(DYPlayer_t *player);
+void          DYPlayer_Pause(DYPlayer_t *player);
+void          DYPlayer_Stop(DYPlayer_t *player);
+void          DYPlayer_Previous(DYPlayer_t *player);
+void          DYPlayer_Next(DYPlayer_t *player);
+void          DYPlayer_PlaySpecified(DYPlayer_t *player, uint16_t number);
+void          DYPlayer_PlaySpecifiedDevicePath(DYPlayer_t *player, device_t device, char *path);
+device_t      DYPlayer_GetPlayingDevice(DYPlayer_t *player);
+void          DYPlayer_SetPlayingDevice(DYPlayer_t *player, device_t device);
+uint16_t      DYPlayer_GetSoundCount(DYPlayer_t *player);
+uint16_t      DYPlayer_GetPlayingSound(DYPlayer_t *player);
+void          DYPlayer_PreviousDir(DYPlayer_t *player, playDirSound_t song);
+uint16_t      DYPlayer_GetFirstInDir(DYPlayer_t *player);
+uint16_t      DYPlayer_GetSoundCountDir(DYPlayer_t *player);
+void          DYPlayer_SetVolume(DYPlayer_t *player, uint8_t volume);
+void          DYPlayer_VolumeIncrease(DYPlayer_t *player);
+void          DYPlayer_VolumeDecrease(DYPlayer_t *player);
+void          DYPlayer_InterludeSpecified(DYPlayer_t *player, device_t device, uint16_t number);
+void          DYPlayer_InterludeSpecifiedDevicePath(DYPlayer_t *player, device_t device, char *path);
+void          DYPlayer_StopInterlude(DYPlayer_t *player);
+void          DYPlayer_SetCycleMode(DYPlayer_t *player, play_mode_t mode);
+void          DYPlayer_SetCycleTimes(DYPlayer_t *player, uint16_t cycles);
+void          DYPlayer_SetEq(DYPlayer_t *player, eq_t eq);
+void          DYPlayer_Select(DYPlayer_t *player, uint16_t number);
+void          DYPlayer_CombinationPlay(DYPlayer_t *player, char *sounds[], uint8_t len);
+void          DYPlayer_EndCombinationPlay(DYPlayer_t *player);
 void          serialWrite(const uint8_t *buffer, uint8_t len);
 void          serialWrite_crc(uint8_t crc);
 uint8_t       serialRead(uint8_t *buffer, uint8_t len);
@@ -144,7 +275,7 @@ uint8_t       checksum(uint8_t *data, uint8_t len);
 bool          validateCrc(uint8_t *data, uint8_t len);
 void          sendCommand_nocrc(uint8_t *data, uint8_t len);
 void          sendCommand(const uint8_t *data, uint8_t len, uint8_t crc);
-bool          getResponse(uint8_t *buffer, uint8_t len);
+bool          getResponse(uint8_t *buffer, uint8_t len, uint8_t opcode);
 void          byPathCommand(uint8_t command, device_t device, char *path);
 
 
@@ -187,7 +318,7 @@ typedef struct
     bool (*validateCrc)(uint8_t *data, uint8_t len);
     void (*sendCommand_nocrc)(uint8_t *data, uint8_t len);
     void (*sendCommand)(const uint8_t *data, uint8_t len, uint8_t crc);
-    bool (*getResponse)(uint8_t *buffer, uint8_t len);
+    bool (*getResponse)(uint8_t *buffer, uint8_t len, uint8_t opcode);
     void (*byPathCommand)(uint8_t command, device_t device, char *path);
 }DYPlayer_st;
 
@@ -215,11 +346,16 @@ typedef struct
 /* Main Struct Pointer Object */
 extern const DYPlayer_st DYPlayer;
 
+/* Fixed frames, SM included, indexed by the enumarators below */
+extern const uint8_t controlCommands[SIZEOF_COMMANDS][LENGTHOF_COMMANDS + LENGTHOF_CRC];
+
+
 /*
  * Control Commands Index Enumarators
  */
 
-#define CMD_CRC_INDEX   3
+#define CMD_OPCODE_INDEX    1
+#define CMD_CRC_INDEX       3
 
 enum
 {
@@ -254,3 +390,5 @@ enum
     SPECPATHINTER_CMD,
     SLCTBUTNOPLAY_CMD,
 };
+
+#endif /* DYPLAYER_H */
@@ -0,0 +1,104 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_Batch.h
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Command sequences packed into one buffer of complete frames, sent
+  *          in a single transport write (one DMA transfer).
+  *
+  *          Batches are built at run time with the DYBatch_ calls, or as
+  *          const data with the DY_BATCH_ macros, which work out the
+  *          checksums at compile time:
+  *
+  *          static const uint8_t sceneBytes[] = {
+  *              DY_BATCH_SETDEVICE(Sd), DY_BATCH_SETVOLUME(20),
+  *              DY_BATCH_SETEQ(Rock),   DY_BATCH_PLAYSPECIFIED(7)
+  *          };
+  *          static const DYBatch_t scene = DY_BATCH(sceneBytes);
+  *
+  *          DYBatch_Send(&dyPlayer, &scene);
+********************************************************************************/
+#ifndef DYPLAYER_BATCH_H
+#define DYPLAYER_BATCH_H
+
+/************************************DEFINES***********************************/
+
+#ifndef DY_BATCH_MAX
+#define DY_BATCH_MAX        64      /* Built batch, fits a DMA TX slot         */
+#endif
+
+#ifndef DY_BATCH_GAP_US
+#define DY_BATCH_GAP_US     0       /* Idle between frames, 0 = one write      */
+#endif
+
+#ifndef DY_BATCH_BYTE_US
+#define DY_BATCH_BYTE_US    1042    /* us per byte on the wire, 9600 8N1       */
+#endif
+
+/* Compile time frames, header to checksum. */
+#define DY_BATCH_CMD0(op)           0xAA, (op), 0x00, (uint8_t)(0xAA + (op))
+#define DY_BATCH_CMD1(op, b)        0xAA, (op), 0x01, (uint8_t)(b), \
+                                    (uint8_t)(0xAA + (op) + 0x01 + (uint8_t)(b))
+#define DY_BATCH_CMD2(op, w)        0xAA, (op), 0x02, (uint8_t)((w) >> 8), (uint8_t)(w), \
+                                    (uint8_t)(0xAA + (op) + 0x02 + (uint8_t)((w) >> 8) + (uint8_t)(w))
+
+#define DY_BATCH_PLAY()             DY_BATCH_CMD0(0x02)
+#define DY_BATCH_PAUSE()            DY_BATCH_CMD0(0x03)
+#define DY_BATCH_STOP()             DY_BATCH_CMD0(0x04)
+#define DY_BATCH_PLAYSPECIFIED(n)   DY_BATCH_CMD2(0x07, n)
+#define DY_BATCH_SETDEVICE(device)  DY_BATCH_CMD1(0x0B, device)
+#define DY_BATCH_SETVOLUME(volume)  DY_BATCH_CMD1(0x13, volume)
+#define DY_BATCH_SETCYCLEMODE(mode) DY_BATCH_CMD1(0x18, mode)
+#define DY_BATCH_SETCYCLETIMES(n)   DY_BATCH_CMD2(0x19, n)
+#define DY_BATCH_SETEQ(eq)          DY_BATCH_CMD1(0x1A, eq)
+#define DY_BATCH_SELECT(n)          DY_BATCH_CMD2(0x1F, n)
+
+/* DYBatch_t initialiser over a byte array of the frames above. */
+#define DY_BATCH(bytes)             { &(bytes)[0], sizeof(bytes) }
+
+/************************************INCLUDES***********************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "DYPlayer.h"
+
+/**
+ * Ready to send batch, may point into flash.
+ */
+typedef struct
+{
+    const uint8_t *data;
+    uint16_t       len;
+} DYBatch_t;
+
+/**
+ * Batch under construction.
+ */
+typedef struct
+{
+    uint8_t  data[DY_BATCH_MAX];
+    uint16_t len;
+    bool     overflow;            /* A frame did not fit, batch invalid         */
+} DYBatchBuilder_t;
+
+/**
+ * Function Declerations
+ */
+void          DYBatch_Begin(DYBatchBuilder_t *builder);
+void          DYBatch_AddFrame(DYBatchBuilder_t *builder, DYFrame_t *frame);
+void          DYBatch_AddControl(DYBatchBuilder_t *builder, uint8_t index);
+void          DYBatch_SetPlayingDevice(DYBatchBuilder_t *builder, device_t device);
+void          DYBatch_SetVolume(DYBatchBuilder_t *builder, uint8_t volume);
+void          DYBatch_SetEq(DYBatchBuilder_t *builder, eq_t eq);
+void          DYBatch_SetCycleMode(DYBatchBuilder_t *builder, play_mode_t mode);
+void          DYBatch_SetCycleTimes(DYBatchBuilder_t *builder, uint16_t cycles);
+void          DYBatch_PlaySpecified(DYBatchBuilder_t *builder, uint16_t number);
+void          DYBatch_Select(DYBatchBuilder_t *builder, uint16_t number);
+bool          DYBatch_End(DYBatchBuilder_t *builder, DYBatch_t *batch);
+bool          DYBatch_Validate(const DYBatch_t *batch);
+bool          DYBatch_Send(DYPlayer_t *player, const DYBatch_t *batch);
+
+#endif /* DYPLAYER_BATCH_H */
@@ -0,0 +1,58 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_Group.h
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Synchronised start of one track on several modules, e.g. a multi
+  *          zone announcement.
+  *
+  *          DYGroup_Arm() selects the track on every module (0x1F, select
+  *          without play) and returns once each of them confirmed it, so
+  *          all UARTs are idle. DYGroup_Fire() then hands the 4 byte play
+  *          frame to every transport back to back without waiting; call it
+  *          from a timer interrupt to start the zones on the tick. With the
+  *          DMA transport each frame is one DMA transfer straight from
+  *          flash, all UARTs send at the same time.
+  *
+  *          Members must be on the IT or DMA transport for Fire to be
+  *          simultaneous, a blocking transport sends the frames in turn.
+  *          Don't write to the members between Arm and Fire.
+********************************************************************************/
+#ifndef DYPLAYER_GROUP_H
+#define DYPLAYER_GROUP_H
+
+/************************************DEFINES***********************************/
+
+#ifndef DY_GROUP_MAX
+#define DY_GROUP_MAX        6       /* Modules per group, UARTs of an F407     */
+#endif
+
+/************************************INCLUDES***********************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "DYPlayer.h"
+
+/**
+ * Modules started together.
+ */
+typedef struct
+{
+    DYPlayer_t *member[DY_GROUP_MAX];
+    uint8_t     count;
+    uint32_t    firedAt;          /* Transport time of the first play frame, us */
+    uint32_t    fireUs;           /* First to last play frame handed out, us    */
+} DYGroup_t;
+
+/**
+ * Function Declerations
+ */
+void          DYGroup_Init(DYGroup_t *group);
+bool          DYGroup_Add(DYGroup_t *group, DYPlayer_t *player);
+bool          DYGroup_Arm(DYGroup_t *group, uint16_t number);
+bool          DYGroup_Fire(DYGroup_t *group);
+
+#endif /* DYPLAYER_GROUP_H */
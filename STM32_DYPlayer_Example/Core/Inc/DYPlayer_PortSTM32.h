@@ -0,0 +1,51 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_PortSTM32.h
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 STM32 HAL transports: blocking, interrupt and DMA.
+********************************************************************************/
+#ifndef DYPLAYER_PORTSTM32_H
+#define DYPLAYER_PORTSTM32_H
+
+/************************************INCLUDES***********************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "main.h"
+#include "DYPlayer_Transport.h"
+#include "DYPlayer_UartIT.h"
+#include "DYPlayer_UartDMA.h"
+
+/**
+ * Context of the STM32 transports. `huart` is always needed, the others are
+ * only used by the transport that needs them and may stay NULL otherwise.
+ * Reception uses `dmaRx` when it is set, blocking HAL_UART_Receive if not.
+ */
+typedef struct
+{
+    UART_HandleTypeDef *huart;    /* Module UART                               */
+    DYUartIT_t         *itTx;     /* DYTransport_IT transmit ring              */
+    DYUartDMA_t        *dmaTx;    /* DYTransport_DMA transmit queue            */
+    DYUartDMARx_t      *dmaRx;    /* Circular DMA receiver, optional           */
+} DYPortSTM32_t;
+
+/**
+ * Method pointer struct implementations
+ */
+extern const DYTransport_st DYTransport_HAL;  /* HAL_UART_Transmit, blocking    */
+extern const DYTransport_st DYTransport_IT;   /* TXE interrupt ring             */
+extern const DYTransport_st DYTransport_DMA;  /* TX DMA queue, flash zero-copy  */
+
+/**
+ * Function Declerations, DYTrace_t clock and dump sinks
+ */
+void          DYPortSTM32_CyclesStart(void);
+uint32_t      DYPortSTM32_Cycles(void);
+void          DYPortSTM32_ItmOut(void *ctx, const uint8_t *data, uint16_t len);
+void          DYPortSTM32_UartOut(void *ctx, const uint8_t *data, uint16_t len);
+
+#endif /* DYPLAYER_PORTSTM32_H */
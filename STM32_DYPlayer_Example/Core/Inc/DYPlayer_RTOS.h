@@ -0,0 +1,126 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_RTOS.h
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 FreeRTOS integration, built with DY_RTOS=1. One driver task owns
+  *          the instance and its UART; client tasks send it commands through
+  *          a FreeRTOS queue and never touch the transport themselves.
+  *
+  *          The driver task runs a DYAsync_t queue with DYPlayer_Process().
+  *          It sleeps on its task notification: clients give one with every
+  *          message, the UART RX interrupt with DYRtos_WakeFromISR(). The
+  *          ISR passes no data itself, the task reads the frames from the
+  *          port's DYRxQueue_t. While commands are pending it also
+  *          wakes every DY_RTOS_TICK_MS for wire pacing and timeouts.
+  *
+  *          A query blocks the calling task on its own notification until
+  *          the driver task reports the answer or the timeout. The state of
+  *          that notification is cleared before the message is queued and
+  *          the result carries the tag of its message, so a stale or foreign
+  *          notification is never taken for the answer. The wait is bounded
+  *          by DY_RTOS_ANSWER_MS, every command that can be ahead taking up
+  *          to DY_RX_TIMEOUT per try. Don't use the notification of a
+  *          client task for anything else while it waits here.
+  *
+  *          host/FreeRTOS.h, task.h and queue.h are a pthread shim of the
+  *          calls used here, for host builds and host/DYRtos_Demo.c.
+********************************************************************************/
+#ifndef DYPLAYER_RTOS_H
+#define DYPLAYER_RTOS_H
+
+/************************************DEFINES***********************************/
+
+#ifndef DY_RTOS
+#define DY_RTOS             0       /* FreeRTOS driver task                    */
+#endif
+
+#ifndef DY_RTOS_QUEUE_LEN
+#define DY_RTOS_QUEUE_LEN   8       /* Messages from client tasks              */
+#endif
+
+#ifndef DY_RTOS_STACK
+#define DY_RTOS_STACK       384     /* Driver task stack, words                */
+#endif
+
+#ifndef DY_RTOS_PRIORITY
+#define DY_RTOS_PRIORITY    (tskIDLE_PRIORITY + 2)
+#endif
+
+#ifndef DY_RTOS_ANSWER_MS
+/* Longest wait of a client for its result, any message ahead may be a query. */
+#define DY_RTOS_ANSWER_MS(retries)  \
+    ((uint32_t)DY_RX_TIMEOUT * ((retries) + 1U) * (DY_RTOS_QUEUE_LEN + DY_ASYNC_QUEUE_LEN + 1U))
+#endif
+
+#ifndef DY_RTOS_TICK_MS
+#define DY_RTOS_TICK_MS     1       /* Driver task period while work pending   */
+#endif
+
+#if DY_RTOS
+
+/************************************INCLUDES***********************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+#include "DYPlayer.h"
+#include "DYPlayer_Async.h"
+
+/**
+ * Message from a client task. `client` is notified with the result when set.
+ */
+typedef struct
+{
+    uint8_t            frame[DY_ASYNC_FRAME_MAX];
+    uint8_t            len;
+    uint8_t            response;      /* Answer opcode, 0 = command            */
+    uint8_t            tag;           /* Returned with the result              */
+    TaskHandle_t       client;
+} DYRtosMsg_t;
+
+/**
+ * Client waiting for a message in the async queue, `client` NULL when free.
+ */
+typedef struct
+{
+    TaskHandle_t       client;
+    uint8_t            tag;
+} DYRtosWaiter_t;
+
+/**
+ * Driver task of one module.
+ */
+typedef struct
+{
+    DYPlayer_t        *player;
+    DYAsync_t          async;
+    QueueHandle_t      queue;
+    TaskHandle_t       task;
+    DYRtosMsg_t        held;          /* Taken from `queue`, async queue full  */
+    bool               holding;
+    uint32_t           messages;      /* Messages passed to the async queue    */
+    DYRtosWaiter_t     waiters[DY_ASYNC_QUEUE_LEN];   /* Driver task only     */
+    uint8_t            tag;           /* Last tag given out, critical section  */
+} DYRtos_t;
+
+/**
+ * Function Declerations
+ */
+bool          DYRtos_Start(DYRtos_t *rtos, DYPlayer_t *player);
+bool          DYRtos_Submit(DYRtos_t *rtos, const uint8_t *frame, uint8_t len, uint8_t response,
+                            uint16_t *value, TickType_t wait);
+bool          DYRtos_Control(DYRtos_t *rtos, uint8_t index, uint16_t *value, TickType_t wait);
+bool          DYRtos_SetVolume(DYRtos_t *rtos, uint8_t volume, TickType_t wait);
+bool          DYRtos_PlaySpecified(DYRtos_t *rtos, uint16_t number, TickType_t wait);
+void          DYRtos_WakeFromISR(DYRtos_t *rtos);
+
+#endif /* DY_RTOS */
+
+#endif /* DYPLAYER_RTOS_H */
@@ -0,0 +1,179 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_Stats.h
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Optional timing of every `DYPlayer` call with the DWT cycle
+  *          counter: call count and min/max/mean cycles, split into time
+  *          blocked in the transport and time spent in the driver.
+  *
+  *          Build with DY_STATS=1 and call DYStats_Init() once. The
+  *          `DYPlayer` method struct then points at timing wrappers; a call
+  *          made from inside another one counts for the outer call only.
+  *          Of the DYPlayer_ calls only Snapshot and Resync are timed. With DY_STATS=0, the default,
+  *          nothing of it is compiled in.
+  *
+  *          The counter is DWT->CYCCNT of the Cortex-M4. Other targets and
+  *          host builds define DY_STATS_CYCLES() (and DY_STATS_START()) to
+  *          their own free running 32 bit counter. Call the API from one
+  *          context only while timing is on.
+********************************************************************************/
+#ifndef DYPLAYER_STATS_H
+#define DYPLAYER_STATS_H
+
+/************************************DEFINES***********************************/
+
+#ifndef DY_STATS
+#define DY_STATS            0       /* 1 = time every DYPlayer call            */
+#endif
+
+/************************************INCLUDES***********************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "DYPlayer.h"
+
+#if DY_STATS && !defined(DY_STATS_CYCLES)
+#include "main.h"                   /* CMSIS core_cm4.h via the device header  */
+#define DY_STATS_CYCLES()   (DWT->CYCCNT)
+#define DY_STATS_START()    do { CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; \
+                                 DWT->CYCCNT = 0;                                \
+                                 DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk; } while (0)
+#endif
+
+#ifndef DY_STATS_START
+#define DY_STATS_START()    do { } while (0)
+#endif
+
+/*
+ * Every call of the `DYPlayer` method struct, in its order:
+ * VOID(name, parameters, arguments) or VALUE(type, name, parameters, arguments).
+ */
+#define DY_STATS_API(VOID, VALUE)                                                               \
+    VOID(serialWrite, (const uint8_t *buffer, uint8_t len), (buffer, len))                      \
+    VOID(serialWrite_crc, (uint8_t crc), (crc))                                                 \
+    VALUE(uint8_t, serialRead, (uint8_t *buffer, uint8_t len), (buffer, len))                   \
+    VALUE(play_state_t, checkPlayState, (void), ())                                             \
+    VOID(play, (void), ())                                                                      \
+    VOID(pause, (void), ())                                                                     \
+    VOID(stop, (void), ())                                                                      \
+    VOID(previous, (void), ())                                                                  \
+    VOID(next, (void), ())                                                                      \
+    VOID(playSpecified, (uint16_t number), (number))                                            \
+    VOID(playSpecifiedDevicePath, (device_t device, char *path), (device, path))                \
+    VALUE(device_t, getPlayingDevice, (void), ())                                               \
+    VOID(setPlayingDevice, (device_t device), (device))                                         \
+    VALUE(uint16_t, getSoundCount, (void), ())                                                  \
+    VALUE(uint16_t, getPlayingSound, (void), ())                                                \
+    VOID(previousDir, (playDirSound_t song), (song))                                            \
+    VALUE(uint16_t, getFirstInDir, (void), ())                                                  \
+    VALUE(uint16_t, getSoundCountDir, (void), ())                                               \
+    VOID(setVolume, (uint8_t volume), (volume))                                                 \
+    VOID(volumeIncrease, (void), ())                                                            \
+    VOID(volumeDecrease, (void), ())                                                            \
+    VOID(interludeSpecified, (device_t device, uint16_t number), (device, number))              \
+    VOID(interludeSpecifiedDevicePath, (device_t device, char *path), (device, path))           \
+    VOID(stopInterlude, (void), ())                                                             \
+    VOID(setCycleMode, (play_mode_t mode), (mode))                                              \
+    VOID(setCycleTimes, (uint16_t cycles), (cycles))                                            \
+    VOID(setEq, (eq_t eq), (eq))                                                                \
+    VOID(select, (uint16_t number), (number))                                                   \
+    VOID(combinationPlay, (char *sounds[], uint8_t len), (sounds, len))                         \
+    VOID(endCombinationPlay, (void), ())                                                        \
+    VALUE(uint8_t, checksum, (uint8_t *data, uint8_t len), (data, len))                         \
+    VALUE(bool, validateCrc, (uint8_t *data, uint8_t len), (data, len))                         \
+    VOID(sendCommand_nocrc, (uint8_t *data, uint8_t len), (data, len))                          \
+    VOID(sendCommand, (const uint8_t *data, uint8_t len, uint8_t crc), (data, len, crc))        \
+    VALUE(bool, getResponse, (uint8_t *buffer, uint8_t len, uint8_t opcode), (buffer, len, opcode)) \
+    VOID(byPathCommand, (uint8_t command, device_t device, char *path), (command, device, path))
+
+#define DY_STATS_ID_VOID(name, params, args)            DY_API_##name,
+#define DY_STATS_ID_VALUE(type, name, params, args)     DY_API_##name,
+
+/**
+ * Index of a call in `DYStats_t.api`.
+ */
+typedef enum
+{
+    DY_STATS_API(DY_STATS_ID_VOID, DY_STATS_ID_VALUE)
+    DY_API_Snapshot,              /* DYPlayer_Snapshot()                        */
+    DY_API_Resync,                /* DYPlayer_Resync()                          */
+    DY_API_COUNT
+} DYApi_t;
+
+/**
+ * Cycles of one part of a call.
+ */
+typedef struct
+{
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;                 /* Mean = sum / calls                         */
+} DYStatsRange_t;
+
+/**
+ * Timing of one call.
+ */
+typedef struct
+{
+    uint32_t       calls;
+    DYStatsRange_t total;         /* Entry to return                            */
+    DYStatsRange_t transport;     /* Blocked in transport write/read/wait       */
+    DYStatsRange_t driver;        /* The rest, total - transport                */
+} DYStatsApi_t;
+
+/**
+ * Everything measured since DYStats_Init() / DYStats_Reset().
+ */
+typedef struct
+{
+    DYStatsApi_t api[DY_API_COUNT];
+    uint32_t     overhead;        /* Cycles of an empty timed call, not taken off */
+} DYStats_t;
+
+#if DY_STATS
+
+#define DY_STATS_DECL_VOID(name, params, args)          void DYStats_##name params;
+#define DY_STATS_DECL_VALUE(type, name, params, args)   type DYStats_##name params;
+
+/* Timing wrappers the `DYPlayer` struct points at. */
+DY_STATS_API(DY_STATS_DECL_VOID, DY_STATS_DECL_VALUE)
+
+/* Method struct entry, the wrapper of `name` */
+#define DY_STATS_ENTRY(name)        DYStats_##name
+/* Time the API function around it */
+#define DY_STATS_ENTER()            DYStats_Enter()
+#define DY_STATS_EXIT(api)          DYStats_Exit(api)
+/* Transport call, its value kept, e.g. n = DY_STATS_IO(io->write(...)) */
+#define DY_STATS_IO(call)           (DYStats_IoBegin(), DYStats_IoEnd(call))
+#define DY_STATS_IO_VOID(call)      do { DYStats_IoBegin(); call; DYStats_IoEnd(0); } while (0)
+
+#else
+
+#define DY_STATS_ENTRY(name)        name
+#define DY_STATS_ENTER()            do { } while (0)
+#define DY_STATS_EXIT(api)          do { } while (0)
+#define DY_STATS_IO(call)           (call)
+#define DY_STATS_IO_VOID(call)      call
+
+#endif /* DY_STATS */
+
+/**
+ * Function Declerations
+ */
+#if DY_STATS
+void          DYStats_Init(void);
+void          DYStats_Reset(void);
+const DYStats_t *DYStats_Get(void);
+const char   *DYStats_Name(DYApi_t api);
+uint32_t      DYStats_Mean(const DYStatsRange_t *range, uint32_t calls);
+void          DYStats_Enter(void);
+void          DYStats_Exit(DYApi_t api);
+void          DYStats_IoBegin(void);
+uint16_t      DYStats_IoEnd(uint16_t value);
+#endif
+
+#endif /* DYPLAYER_STATS_H */
@@ -0,0 +1,112 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_UartDMA.h
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 DMA driven UART transmit and receive paths. Constant frames are
+  *          sent straight from flash, RAM frames are copied once into a driver
+  *          owned slot. Reception runs in a circular DMA buffer framed by the
+  *          UART IDLE line interrupt; the interrupt parses the bytes and hands
+  *          complete, checked answer frames over in a DYRxQueue_t.
+********************************************************************************/
+#ifndef DYPLAYER_UARTDMA_H
+#define DYPLAYER_UARTDMA_H
+
+/************************************DEFINES***********************************/
+
+#ifndef DY_DMA_TX_QUEUE_LEN
+#define DY_DMA_TX_QUEUE_LEN     8       /* Power of two, queued transfers.     */
+#endif
+
+#ifndef DY_DMA_TX_SLOT_SIZE
+#define DY_DMA_TX_SLOT_SIZE     64      /* Biggest RAM frame, see DY_FRAME_MAX. */
+#endif
+
+#ifndef DY_DMA_RX_BUFFER_SIZE
+#define DY_DMA_RX_BUFFER_SIZE   64      /* Circular DMA target, several frames */
+#endif
+
+/* DMA1/DMA2 can read flash directly, so such buffers need no copy. */
+#define DY_DMA_IS_FLASH(p)      (((uintptr_t)(p) >= FLASH_BASE) && \
+                                 ((uintptr_t)(p) <= FLASH_END))
+
+/************************************INCLUDES***********************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "main.h"
+#include "DYPlayer_Parser.h"
+#include "DYPlayer_RxQueue.h"
+
+/**
+ * Called from interrupt context each time a queued buffer has left the UART.
+ */
+typedef void (*DYPlayer_TxCallback_t)(const uint8_t *data, uint16_t len);
+
+/**
+ * Called from interrupt context with every chunk of received bytes.
+ */
+typedef void (*DYPlayer_RxCallback_t)(const uint8_t *data, uint16_t len);
+
+/**
+ * One pending DMA transfer.
+ */
+typedef struct
+{
+    const uint8_t *data;    /* Flash address or one of the port slots         */
+    uint16_t       len;     /* Bytes to send                                  */
+} DYDmaTxDesc_t;
+
+/**
+ * One DMA transmit port, one per UART.
+ */
+typedef struct
+{
+    UART_HandleTypeDef    *huart;                                          /* HAL handle, hdmatx linked */
+    DYDmaTxDesc_t          queue[DY_DMA_TX_QUEUE_LEN];                     /* Pending transfers         */
+    volatile uint8_t       head;                                           /* Written by the producer   */
+    volatile uint8_t       tail;                                           /* Written by the TC IRQ     */
+    volatile bool          active;                                         /* A transfer is running     */
+    uint32_t               dropped;                                        /* Refused by the HAL        */
+    uint32_t               stalls;                                         /* Starts refused, HAL_BUSY  */
+    DYPlayer_TxCallback_t  txCallback;                                     /* Completion, may be NULL   */
+    uint8_t                slot[DY_DMA_TX_QUEUE_LEN][DY_DMA_TX_SLOT_SIZE]; /* Copies of RAM frames      */
+} DYUartDMA_t;
+
+/**
+ * One circular DMA receive port, one per UART. The DMA never stops, frame
+ * boundaries are reported by the UART IDLE line interrupt. `parser` belongs
+ * to the interrupt, `readPos` to the reader.
+ */
+typedef struct
+{
+    UART_HandleTypeDef    *huart;                             /* HAL handle, hdmarx linked (circular) */
+    uint16_t               rxPos;                             /* DMA buffer index already handled     */
+    DYParser_t             parser;                            /* Frames the received bytes            */
+    DYRxQueue_t            frames;                            /* Checked frames, not yet read         */
+    uint8_t                readPos;                           /* Bytes of the oldest frame read       */
+    DYPlayer_RxCallback_t  rxCallback;                        /* New bytes, may be NULL               */
+    volatile bool          restart;                           /* Restart refused, Read retries it     */
+    uint32_t               restartFails;                      /* Restarts refused by the HAL          */
+    uint8_t                dmaBuffer[DY_DMA_RX_BUFFER_SIZE];  /* DMA target                           */
+} DYUartDMARx_t;
+
+/**
+ * Function Declerations
+ */
+void          DYPlayer_UartDMA_Init(DYUartDMA_t *port, UART_HandleTypeDef *huart);
+void          DYPlayer_UartDMA_SetTxCallback(DYUartDMA_t *port, DYPlayer_TxCallback_t callback);
+bool          DYPlayer_UartDMA_Write(DYUartDMA_t *port, const uint8_t *data, uint16_t len);
+void          DYPlayer_UartDMA_Poll(DYUartDMA_t *port);
+bool          DYPlayer_UartDMA_Busy(DYUartDMA_t *port);
+void          DYPlayer_UartDMA_TxCpltHandler(DYUartDMA_t *port, UART_HandleTypeDef *huart);
+void          DYPlayer_UartDMA_RxStart(DYUartDMARx_t *port, UART_HandleTypeDef *huart);
+void          DYPlayer_UartDMA_SetRxCallback(DYUartDMARx_t *port, DYPlayer_RxCallback_t callback);
+uint16_t      DYPlayer_UartDMA_Read(DYUartDMARx_t *port, uint8_t *buffer, uint16_t len);
+void          DYPlayer_UartDMA_RxEventHandler(DYUartDMARx_t *port, UART_HandleTypeDef *huart, uint16_t pos);
+void          DYPlayer_UartDMA_RxErrorHandler(DYUartDMARx_t *port, UART_HandleTypeDef *huart);
+
+#endif /* DYPLAYER_UARTDMA_H */
@@ -57,6 +57,9 @@ void Error_Handler(void);
 /* USER CODE END EFP */
 
 /* Private defines -----------------------------------------------------------*/
+#define DY_BUSY_Pin GPIO_PIN_4
+#define DY_BUSY_GPIO_Port GPIOA
+#define DY_BUSY_EXTI_IRQn EXTI4_IRQn
 /* USER CODE BEGIN Private defines */
 
 /* USER CODE END Private defines */
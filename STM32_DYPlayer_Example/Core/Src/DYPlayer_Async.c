@@ -0,0 +1,685 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_Async.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Non-blocking command queue on top of a driver instance.
+********************************************************************************/
+/************************************DEFINES***********************************/
+
+#define ASYNC_MASK          (DY_ASYNC_QUEUE_LEN - 1)
+#define URGENT_MASK         (DY_ASYNC_URGENT_LEN - 1)
+#define ASYNC_READ_CHUNK    16      /* Bytes taken from the transport per read */
+
+#define OP_PAUSE            0x03
+#define OP_STOP             0x04
+#define OP_PLAYSPECIFIED    0x07
+#define OP_STOPINTERLUDE    0x10
+#define OP_SETVOLUME        0x13
+#define OP_VOLUMEINC        0x14
+#define OP_VOLUMEDEC        0x15
+#define OP_SELECT           0x1F
+
+/************************************INCLUDES***********************************/
+#include <string.h>
+
+#include "DYPlayer_Async.h"
+#include "DYPlayer_Ring.h"
+
+#if (DY_ASYNC_QUEUE_LEN & ASYNC_MASK) != 0 || DY_ASYNC_QUEUE_LEN > 128
+#error "DY_ASYNC_QUEUE_LEN must be a power of 2, at most 128"
+#endif
+#if (DY_ASYNC_URGENT_LEN & URGENT_MASK) != 0 || DY_ASYNC_URGENT_LEN > 128
+#error "DY_ASYNC_URGENT_LEN must be a power of 2, at most 128"
+#endif
+#if DY_ASYNC_FRAME_MAX < DY_FRAME_MAX || DY_ASYNC_FRAME_MAX > 255
+#error "DY_ASYNC_FRAME_MAX must hold every frame the driver builds (DY_FRAME_MAX), at most 255"
+#endif
+
+static void asyncProcess(void *ctx, uint32_t now);
+
+
+/*******************************************************************************
+  @func    : DYAsync_Init
+  @param   : DYAsync_t *async, DYPlayer_t *player
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Empty queue on an initialised driver instance.
+********************************************************************************/
+void DYAsync_Init(DYAsync_t *async, DYPlayer_t *player) {
+    memset(async, 0, sizeof(*async));
+    async->player   = player;
+    async->depth    = DY_ASYNC_DEPTH;
+    async->coalesce = true;
+    async->priority = true;
+    async->retries  = DY_ASYNC_RETRIES;
+    player->process    = asyncProcess;
+    player->processCtx = async;
+}
+/*******************************************************************************
+  @func    : DYAsync_SetDepth
+  @param   : DYAsync_t *async, uint8_t depth
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Frames allowed on the wire before the oldest is answered. 1 sends
+             a query only after the previous one finished; more pipelines
+             them, the module answers in order. Takes effect on the next send.
+********************************************************************************/
+void DYAsync_SetDepth(DYAsync_t *async, uint8_t depth) {
+    async->depth = (depth == 0) ? 1 : depth;
+}
+/*******************************************************************************
+  @func    : DYAsync_SetCoalescing
+  @param   : DYAsync_t *async, bool enable
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Merge volume steps and superseded track requests still in the
+             queue (on by default).
+********************************************************************************/
+void DYAsync_SetCoalescing(DYAsync_t *async, bool enable) {
+    async->coalesce = enable;
+}
+/*******************************************************************************
+  @func    : DYAsync_SetPriority
+  @param   : DYAsync_t *async, bool enable
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Route pause, stop and stop interlude through the urgent lane (on
+             by default). Off, they wait their turn like every command.
+********************************************************************************/
+void DYAsync_SetPriority(DYAsync_t *async, bool enable) {
+    async->priority = enable;
+}
+/*******************************************************************************
+  @func    : DYAsync_SetRetries
+  @param   : DYAsync_t *async, uint8_t retries
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Times an unanswered query is sent again before it completes as
+             DY_ASYNC_TIMEOUT. Resends go out at the next frame boundary,
+             after the urgent lane.
+********************************************************************************/
+void DYAsync_SetRetries(DYAsync_t *async, uint8_t retries) {
+    async->retries = retries;
+}
+/*******************************************************************************
+  @func    : DYAsync_Cancel
+  @param   : DYAsync_t *async
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Drop every command submitted so far that has not started on the
+             wire, e.g. together with an urgent stop so queued play requests
+             do not start the audio again. They complete as
+             DY_ASYNC_CANCELLED on the next DYAsync_Process(). Urgent and
+             answered commands are not affected. Call from the submit side.
+********************************************************************************/
+void DYAsync_Cancel(DYAsync_t *async) {
+    async->cancelTo = async->head;
+    async->cancel   = true;
+}
+/*******************************************************************************
+  @func    : DYAsync_Pending
+  @param   : const DYAsync_t *async
+  @return  : uint8_t
+  @date	   : 16.10.26
+  @brief   : Commands queued or in flight, both lanes.
+********************************************************************************/
+uint8_t DYAsync_Pending(const DYAsync_t *async) {
+    return (uint8_t)(async->head - async->tail) + (uint8_t)(async->urgentHead - async->urgentTail);
+}
+/*******************************************************************************
+  @func    : isUrgent
+  @param   : const uint8_t *frame, uint8_t len, uint8_t response
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Transport controls that must not wait behind queued work.
+********************************************************************************/
+static bool isUrgent(const uint8_t *frame, uint8_t len, uint8_t response) {
+    if ((response != 0) || (len <= CMD_OPCODE_INDEX)) {
+        return false;
+    }
+    return (frame[CMD_OPCODE_INDEX] == OP_PAUSE) || (frame[CMD_OPCODE_INDEX] == OP_STOP) ||
+           (frame[CMD_OPCODE_INDEX] == OP_STOPINTERLUDE);
+}
+/*******************************************************************************
+  @func    : DYAsync_Submit
+  @param   : DYAsync_t *async, const uint8_t *frame, uint8_t len, uint8_t response,
+             DYAsync_Callback_t callback, void *ctx, DYFuture_t *future
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Queue a complete frame, SM included. With `response` set the
+             command is done once an answer with that opcode came in, else
+             once the transport took it. `callback` and `future` may be NULL.
+             Urgent commands go to their own lane, see DYAsync_SetPriority().
+             Returns false if the lane is full or the frame too long.
+********************************************************************************/
+bool DYAsync_Submit(DYAsync_t *async, const uint8_t *frame, uint8_t len, uint8_t response,
+                    DYAsync_Callback_t callback, void *ctx, DYFuture_t *future) {
+    if ((len == 0) || (len > DY_ASYNC_FRAME_MAX)) {
+        return false;
+    }
+
+    bool          urgent = async->priority && isUrgent(frame, len, response);
+    DYAsyncCmd_t *cmd;
+
+    if (urgent) {
+        if ((uint8_t)(async->urgentHead - async->urgentTail) >= DY_ASYNC_URGENT_LEN) {
+            return false;
+        }
+        cmd = &async->urgent[async->urgentHead & URGENT_MASK];
+    } else {
+        if ((uint8_t)(async->head - async->tail) >= DY_ASYNC_QUEUE_LEN) {
+            return false;
+        }
+        cmd = &async->queue[async->head & ASYNC_MASK];
+    }
+
+    memcpy(&cmd->frame[0], frame, len);
+    cmd->len      = len;
+    cmd->sent     = 0;
+    cmd->tries    = 0;
+    cmd->response = response;
+    cmd->status   = DY_ASYNC_QUEUED;
+    cmd->callback = callback;
+    cmd->ctx      = ctx;
+    cmd->future   = future;
+    if (future != NULL) {
+        future->value  = 0;
+        future->status = DY_ASYNC_QUEUED;
+    }
+
+    /* Publish only once the slot is filled, Process may run in between. */
+    DY_RING_BARRIER();
+    if (urgent) {
+        async->urgentHead++;
+    } else {
+        async->head++;
+    }
+    return true;
+}
+/*******************************************************************************
+  @func    : DYAsync_SubmitFrame
+  @param   : DYAsync_t *async, DYFrame_t *frame,
+             DYAsync_Callback_t callback, void *ctx, DYFuture_t *future
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Close a built frame and queue it, no answer expected.
+********************************************************************************/
+bool DYAsync_SubmitFrame(DYAsync_t *async, DYFrame_t *frame,
+                         DYAsync_Callback_t callback, void *ctx, DYFuture_t *future) {
+    uint8_t len = DYFrame_End(frame);
+
+    return DYAsync_Submit(async, &frame->data[0], len, 0, callback, ctx, future);
+}
+/*******************************************************************************
+  @func    : DYAsync_Control
+  @param   : DYAsync_t *async, uint8_t index,
+             DYAsync_Callback_t callback, void *ctx, DYFuture_t *future
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Queue a fixed control or query row of controlCommands[], e.g.
+             QCURRENTSONG_CMD. Queries complete with the answer in `value`.
+             Setting rows need data, use the wrappers or SubmitFrame.
+********************************************************************************/
+bool DYAsync_Control(DYAsync_t *async, uint8_t index,
+                     DYAsync_Callback_t callback, void *ctx, DYFuture_t *future) {
+    if (index >= SETVOLUME_CMD) {
+        return false;
+    }
+
+    const uint8_t *row      = &controlCommands[index][0];
+    uint8_t        response = (index >= QPLAY_CMD) ? row[CMD_OPCODE_INDEX] : 0;
+
+    return DYAsync_Submit(async, row, LENGTHOF_COMMANDS + LENGTHOF_CRC, response, callback, ctx, future);
+}
+/*******************************************************************************
+  @func    : DYAsync_SetVolume
+  @param   : DYAsync_t *async, uint8_t volume,
+             DYAsync_Callback_t callback, void *ctx, DYFuture_t *future
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Queued setVolume().
+********************************************************************************/
+bool DYAsync_SetVolume(DYAsync_t *async, uint8_t volume,
+                       DYAsync_Callback_t callback, void *ctx, DYFuture_t *future) {
+    DYFrame_t frame;
+
+    DYFrame_Begin(&frame, controlCommands[SETVOLUME_CMD][CMD_OPCODE_INDEX]);
+    DYFrame_PutByte(&frame, volume);
+    return DYAsync_SubmitFrame(async, &frame, callback, ctx, future);
+}
+/*******************************************************************************
+  @func    : DYAsync_PlaySpecified
+  @param   : DYAsync_t *async, uint16_t number,
+             DYAsync_Callback_t callback, void *ctx, DYFuture_t *future
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Queued playSpecified().
+********************************************************************************/
+bool DYAsync_PlaySpecified(DYAsync_t *async, uint16_t number,
+                           DYAsync_Callback_t callback, void *ctx, DYFuture_t *future) {
+    DYFrame_t frame;
+
+    DYFrame_Begin(&frame, controlCommands[SPECIFIEDSONG_CMD][CMD_OPCODE_INDEX]);
+    DYFrame_PutWord(&frame, number);
+    return DYAsync_SubmitFrame(async, &frame, callback, ctx, future);
+}
+/*******************************************************************************
+  @func    : DYAsync_Select
+  @param   : DYAsync_t *async, uint16_t number,
+             DYAsync_Callback_t callback, void *ctx, DYFuture_t *future
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Queued select().
+********************************************************************************/
+bool DYAsync_Select(DYAsync_t *async, uint16_t number,
+                    DYAsync_Callback_t callback, void *ctx, DYFuture_t *future) {
+    DYFrame_t frame;
+
+    DYFrame_Begin(&frame, controlCommands[SLCTBUTNOPLAY_CMD][CMD_OPCODE_INDEX]);
+    DYFrame_PutWord(&frame, number);
+    return DYAsync_SubmitFrame(async, &frame, callback, ctx, future);
+}
+/*******************************************************************************
+  @func    : complete
+  @param   : DYAsync_t *async, DYAsyncCmd_t *cmd, DYAsyncStatus_t status, uint16_t value
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Finish a command and release its slot, or for the main lane the
+             finished slots at the tail.
+             They are released before the callback runs, so the callback may
+             submit the next command.
+********************************************************************************/
+static void complete(DYAsync_t *async, DYAsyncCmd_t *cmd, DYAsyncStatus_t status, uint16_t value) {
+    DYAsync_Callback_t callback = cmd->callback;
+    void              *ctx      = cmd->ctx;
+
+    if (cmd->status == DY_ASYNC_SENT) {
+        async->inflight--;
+    }
+    if (cmd == async->resend) {
+        /* A copy on the way still goes out whole */
+        async->resend = NULL;
+    }
+    cmd->status = status;
+    if (cmd->future != NULL) {
+        cmd->future->value  = value;
+        cmd->future->status = status;
+    }
+    if (status == DY_ASYNC_TIMEOUT) {
+        async->timeouts++;
+        async->player->rxTimeouts++;
+    } else if (status == DY_ASYNC_DONE) {
+        async->completed++;
+    }
+
+    /* Done with the slot before Submit may fill it again. */
+    DY_RING_BARRIER();
+    if ((cmd >= &async->urgent[0]) && (cmd < &async->urgent[DY_ASYNC_URGENT_LEN])) {
+        async->urgentTail++;
+    }
+    while ((async->tail != async->next) &&
+           (async->queue[async->tail & ASYNC_MASK].status >= DY_ASYNC_DONE)) {
+        async->tail++;
+    }
+
+    if (callback != NULL) {
+        callback(ctx, status, value);
+    }
+}
+/*******************************************************************************
+  @func    : receive
+  @param   : DYAsync_t *async
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : A frame is complete in the parser. Finish the oldest query in
+             flight with the same opcode with the answer value (1 or 2 data
+             bytes, big endian). The module answers in order, so queries sent
+             before it lost their answer and time out now; a query sent again
+             after it keeps waiting. A frame nothing waits for was unsolicited
+             and is left to the parser handlers.
+********************************************************************************/
+static void receive(DYAsync_t *async) {
+    const DYParser_t *parser = &async->player->parser;
+    uint8_t           opcode = parser->frame[1];
+    uint8_t           i;
+
+    for (i = async->tail; i != async->next; i++) {
+        const DYAsyncCmd_t *cmd = &async->queue[i & ASYNC_MASK];
+        if ((cmd->status == DY_ASYNC_SENT) && (cmd->response == opcode)) {
+            break;
+        }
+    }
+    if (i == async->next) {
+        return;
+    }
+
+    const uint8_t *data  = &parser->frame[3];
+    uint16_t       value = (parser->frame[DY_FRAME_LEN_INDEX] >= 2) ?
+                           (uint16_t)((data[0] << 8) | data[1]) : data[0];
+
+    DYAsyncCmd_t *answered = &async->queue[i & ASYNC_MASK];
+
+    for (uint8_t k = async->tail; k != i; k++) {
+        DYAsyncCmd_t *lost = &async->queue[k & ASYNC_MASK];
+        if ((lost->status == DY_ASYNC_SENT) && (lost != async->resend) &&
+            ((int32_t)(answered->sentAt - lost->sentAt) >= 0)) {
+            complete(async, lost, DY_ASYNC_TIMEOUT, 0);
+        }
+    }
+    complete(async, answered, DY_ASYNC_DONE, value);
+}
+/*******************************************************************************
+  @func    : expire
+  @param   : DYAsync_t *async, uint32_t now
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Queries left unanswered for DY_RX_TIMEOUT are sent again while
+             they have retries left, one at a time, else they time out. They
+             were sent in order, so the check stops at the first one still in
+             time.
+********************************************************************************/
+static void expire(DYAsync_t *async, uint32_t now) {
+    for (uint8_t i = async->tail; i != async->next; i++) {
+        DYAsyncCmd_t *cmd = &async->queue[i & ASYNC_MASK];
+        if ((cmd->status != DY_ASYNC_SENT) || (cmd == async->resend)) {
+            continue;
+        }
+        if ((int32_t)(now - cmd->sentAt) < (int32_t)(DY_RX_TIMEOUT * 1000U)) {
+            return;
+        }
+        if (cmd->tries < async->retries) {
+            if ((async->resend == NULL) && (async->resendLen == 0)) {
+                memcpy(&async->resendFrame[0], &cmd->frame[0], cmd->len);
+                async->resendLen  = cmd->len;
+                async->resendSent = 0;
+                async->resend     = cmd;
+                cmd->tries++;
+            }
+            return;
+        }
+        complete(async, cmd, DY_ASYNC_TIMEOUT, 0);
+    }
+}
+/*******************************************************************************
+  @func    : isVolume
+  @param   : const DYAsyncCmd_t *cmd
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : setVolume, volume + or volume - frame.
+********************************************************************************/
+static bool isVolume(const DYAsyncCmd_t *cmd) {
+    uint8_t op = cmd->frame[CMD_OPCODE_INDEX];
+
+    return (cmd->response == 0) &&
+           (((op == OP_SETVOLUME) && (cmd->len == DY_FRAME_OVERHEAD + 1)) ||
+            (op == OP_VOLUMEINC) || (op == OP_VOLUMEDEC));
+}
+/*******************************************************************************
+  @func    : isTarget
+  @param   : const DYAsyncCmd_t *cmd
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : playSpecified or select frame.
+********************************************************************************/
+static bool isTarget(const DYAsyncCmd_t *cmd) {
+    uint8_t op = cmd->frame[CMD_OPCODE_INDEX];
+
+    return (cmd->response == 0) && (cmd->len == DY_FRAME_OVERHEAD + 2) &&
+           ((op == OP_PLAYSPECIFIED) || (op == OP_SELECT));
+}
+/*******************************************************************************
+  @func    : volumeAfter
+  @param   : const DYAsyncCmd_t *cmd, uint8_t volume
+  @return  : uint8_t
+  @date	   : 16.10.26
+  @brief   : Module volume after the volume frame `cmd`, from `volume` before.
+********************************************************************************/
+static uint8_t volumeAfter(const DYAsyncCmd_t *cmd, uint8_t volume) {
+    switch (cmd->frame[CMD_OPCODE_INDEX]) {
+        case OP_SETVOLUME:
+            return (cmd->frame[3] > DY_VOLUME_MAX) ? DY_VOLUME_MAX : cmd->frame[3];
+        case OP_VOLUMEINC:
+            return (volume < DY_VOLUME_MAX) ? (volume + 1) : volume;
+        default:
+            return (volume > 0) ? (volume - 1) : volume;
+    }
+}
+/*******************************************************************************
+  @func    : coalesce
+  @param   : DYAsync_t *async
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Before the frame at `next` goes out, fold it into the one queued
+             behind it where that one makes it pointless:
+             - a volume frame followed by another one; the second becomes a
+               setVolume of the volume both together lead to. Steps need the
+               volume before them, i.e. a known shadow volume or a setVolume
+               earlier in the run.
+             - a playSpecified or select followed by a playSpecified, or a
+               select followed by a select.
+             Folded frames complete without being sent.
+********************************************************************************/
+static void coalesce(DYAsync_t *async) {
+    DYShadow_t *shadow = &async->player->shadow;
+
+    while ((uint8_t)(async->head - async->next) >= 2) {
+        DYAsyncCmd_t *cmd   = &async->queue[async->next & ASYNC_MASK];
+        DYAsyncCmd_t *after = &async->queue[(async->next + 1) & ASYNC_MASK];
+
+        DY_RING_BARRIER();  /* `after` is filled, see DYAsync_Submit(). */
+        if ((cmd->sent != 0) || (cmd->response != 0)) {
+            return;
+        }
+
+        if (isVolume(cmd) && isVolume(after)) {
+            bool absolute = (cmd->frame[CMD_OPCODE_INDEX] == OP_SETVOLUME);
+            if (!absolute && !(shadow->known & DY_SHADOW_VOLUME)) {
+                return;
+            }
+
+            uint8_t   volume = volumeAfter(after, volumeAfter(cmd, shadow->volume));
+            DYFrame_t frame;
+
+            DYFrame_Begin(&frame, OP_SETVOLUME);
+            DYFrame_PutByte(&frame, volume);
+            after->len = DYFrame_End(&frame);
+            memcpy(&after->frame[0], &frame.data[0], after->len);
+        } else if (!(isTarget(cmd) && isTarget(after) &&
+                     ((after->frame[CMD_OPCODE_INDEX] == OP_PLAYSPECIFIED) ||
+                      (after->frame[CMD_OPCODE_INDEX] == cmd->frame[CMD_OPCODE_INDEX])))) {
+            return;
+        }
+
+        async->coalesced++;
+        async->next++;
+        complete(async, cmd, DY_ASYNC_DONE, 0);
+    }
+}
+/*******************************************************************************
+  @func    : cancel
+  @param   : DYAsync_t *async
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Carry out DYAsync_Cancel() once no frame is half way out.
+********************************************************************************/
+static void cancel(DYAsync_t *async) {
+    uint8_t head = async->head;
+
+    DY_RING_BARRIER();
+    if ((async->next != head) && (async->queue[async->next & ASYNC_MASK].sent != 0)) {
+        return;
+    }
+
+    uint8_t count = (uint8_t)(async->cancelTo - async->next);
+
+    async->cancel = false;
+    if (count > (uint8_t)(head - async->next)) {
+        return;     /* Everything it covered is on the wire already. */
+    }
+    while (count-- > 0) {
+        DYAsyncCmd_t *cmd = &async->queue[async->next & ASYNC_MASK];
+        async->next++;
+        complete(async, cmd, DY_ASYNC_CANCELLED, 0);
+    }
+}
+/*******************************************************************************
+  @func    : transmit
+  @param   : DYAsync_t *async
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Hand commands to the transport, one frame at a time:
+             - at every frame boundary the urgent lane goes first, regardless
+               of answers outstanding or the wire time of the last frame,
+             - then a query being sent again, once the last frame had its
+               wire time,
+             - the main lane while fewer than `depth` queries wait for an
+               answer, each frame started only once the previous one had its
+               wire time, so the rest stay queued where they can still be
+               coalesced.
+             A frame the transport could only take part of goes on next call.
+********************************************************************************/
+static void transmit(DYAsync_t *async) {
+    const DYTransport_st *io  = async->player->transport;
+    void                 *ctx = async->player->ctx;
+
+    for (;;) {
+        uint8_t       head       = async->head;
+        uint8_t       urgentHead = async->urgentHead;
+
+        /* Slots before the heads just read are filled, see DYAsync_Submit(). */
+        DY_RING_BARRIER();
+
+        bool          midFrame = (async->next != head) &&
+                                 (async->queue[async->next & ASYNC_MASK].sent != 0);
+        bool          midResend = (async->resendSent != 0);
+        bool          urgent   = !midFrame && !midResend && (async->urgentTail != urgentHead);
+        uint32_t      start    = io->now(ctx);
+        DYAsyncCmd_t *cmd;
+
+        if (!midFrame && !urgent && (async->resendLen != 0)) {
+            if (!midResend && ((int32_t)(start - async->readyAt) < 0)) {
+                return;
+            }
+            async->resendSent += io->write(ctx, &async->resendFrame[async->resendSent],
+                                           async->resendLen - async->resendSent);
+            if (async->resendSent < async->resendLen) {
+                return;
+            }
+            async->readyAt = start + (async->resendLen * DY_ASYNC_BYTE_US);
+            async->player->txFrames++;
+            async->player->txBytes += async->resendLen;
+            async->resent++;
+            if (async->resend != NULL) {
+                async->resend->sentAt = io->now(ctx);
+            }
+            async->resend     = NULL;
+            async->resendLen  = 0;
+            async->resendSent = 0;
+            continue;
+        }
+        if (urgent) {
+            cmd = &async->urgent[async->urgentTail & URGENT_MASK];
+        } else {
+            if ((async->next == head) || (async->inflight >= async->depth)) {
+                return;
+            }
+            cmd = &async->queue[async->next & ASYNC_MASK];
+            if (cmd->sent == 0) {
+                if ((int32_t)(start - async->readyAt) < 0) {
+                    return;
+                }
+                if (async->coalesce) {
+                    coalesce(async);
+                    cmd = &async->queue[async->next & ASYNC_MASK];
+                }
+                if (async->inflight == 0) {
+                    /* Drop what is left of an answer that came in after its timeout. */
+                    DYParser_Reset(&async->player->parser);
+                }
+            }
+        }
+
+        cmd->sent += io->write(ctx, &cmd->frame[cmd->sent], cmd->len - cmd->sent);
+        if (cmd->sent < cmd->len) {
+            return;
+        }
+        async->readyAt = start + (cmd->len * DY_ASYNC_BYTE_US);
+        DYShadow_Record(&async->player->shadow, &cmd->frame[0]);
+        async->player->txFrames++;
+        async->player->txBytes += cmd->len;
+
+        if (urgent) {
+            complete(async, cmd, DY_ASYNC_DONE, 0);
+            continue;
+        }
+        async->next++;
+
+        if (cmd->response == 0) {
+            complete(async, cmd, DY_ASYNC_DONE, 0);
+        } else {
+            cmd->status = DY_ASYNC_SENT;
+            cmd->sentAt = io->now(ctx);
+            if (cmd->future != NULL) {
+                cmd->future->status = DY_ASYNC_SENT;
+            }
+            async->inflight++;
+        }
+    }
+}
+/*******************************************************************************
+  @func    : asyncProcess
+  @param   : void *ctx, uint32_t now
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Advance the queue without waiting: parse the bytes already
+             received, resend or time out queries left unanswered for
+             DY_RX_TIMEOUT, then send what the transport has room for.
+             `now` is transport time. The DYPlayer_Process() hook.
+********************************************************************************/
+static void asyncProcess(void *ctx, uint32_t now) {
+    DYAsync_t            *async = (DYAsync_t *)ctx;
+    const DYTransport_st *io    = async->player->transport;
+    uint8_t               buf[ASYNC_READ_CHUNK];
+    uint16_t              n;
+
+    while ((n = io->read(async->player->ctx, &buf[0], sizeof(buf), 0)) > 0) {
+        for (uint16_t i = 0; i < n; i++) {
+            if (DYParser_Feed(&async->player->parser, buf[i])) {
+                receive(async);
+            }
+        }
+    }
+
+    expire(async, now);
+    if (async->cancel) {
+        cancel(async);
+    }
+    transmit(async);
+}
+/*******************************************************************************
+  @func    : DYAsync_Process
+  @param   : DYAsync_t *async
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYPlayer_Process() of the queue's instance at the transport time.
+             Call it from the main loop or a periodic ISR, completions are
+             reported from here.
+
+             With the blocking HAL transport a send still takes its frame time.
+********************************************************************************/
+void DYAsync_Process(DYAsync_t *async) {
+    asyncProcess(async, async->player->transport->now(async->player->ctx));
+}
+/*******************************************************************************
+  @func    : DYFuture_Ready
+  @param   : const DYFuture_t *future
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : True once the command finished, done or timed out.
+********************************************************************************/
+bool DYFuture_Ready(const DYFuture_t *future) {
+    return future->status >= DY_ASYNC_DONE;
+}
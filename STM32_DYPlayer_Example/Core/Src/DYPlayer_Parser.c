@@ -0,0 +1,220 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_Parser.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Byte at a time parser of DY-XXXX frames with 0xAA resync.
+********************************************************************************/
+/************************************DEFINES***********************************/
+
+#define STEP_MORE           0       /* Frame not complete yet                  */
+#define STEP_FRAME          1       /* Valid frame in parser->frame            */
+#define STEP_ERROR          2       /* Bad length or checksum, resync          */
+
+/************************************INCLUDES***********************************/
+#include <string.h>
+
+#include "DYPlayer_Parser.h"
+
+
+/*******************************************************************************
+  @func    : step
+  @param   : DYParser_t *parser, uint8_t byte
+  @return  : uint8_t
+  @date	   : 16.10.26
+  @brief   : Advance the frame state machine by one byte.
+********************************************************************************/
+static uint8_t step(DYParser_t *parser, uint8_t byte) {
+    if (parser->len == 0) {
+        if (byte != DY_FRAME_HEADER) {
+            parser->skipped++;
+            return STEP_MORE;
+        }
+        parser->frame[0] = byte;
+        parser->sum      = byte;
+        parser->len      = 1;
+        return STEP_MORE;
+    }
+
+    parser->frame[parser->len++] = byte;
+
+    if (parser->len <= DY_FRAME_LEN_INDEX) {
+        parser->sum += byte;
+        return STEP_MORE;
+    }
+    if ((parser->len == (DY_FRAME_LEN_INDEX + 1)) && (byte > DY_PARSER_MAX_DATA)) {
+        return STEP_ERROR;
+    }
+    if (parser->len < (parser->frame[DY_FRAME_LEN_INDEX] + DY_FRAME_OVERHEAD)) {
+        parser->sum += byte;
+        return STEP_MORE;
+    }
+    return (byte == parser->sum) ? STEP_FRAME : STEP_ERROR;
+}
+/*******************************************************************************
+  @func    : dispatch
+  @param   : DYParser_t *parser
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Hand the complete frame to its opcode handler, or the fallback.
+********************************************************************************/
+static void dispatch(DYParser_t *parser) {
+    uint8_t opcode = parser->frame[1];
+
+    parser->complete = true;
+    parser->frames++;
+
+    if ((opcode < DY_PARSER_OPCODES) && (parser->handler[opcode] != NULL)) {
+        parser->handler[opcode](parser->handlerCtx[opcode], opcode, &parser->frame[3],
+                                parser->frame[DY_FRAME_LEN_INDEX]);
+    } else if (parser->fallback != NULL) {
+        parser->fallback(parser->fallbackCtx, opcode, &parser->frame[3],
+                         parser->frame[DY_FRAME_LEN_INDEX]);
+    }
+}
+/*******************************************************************************
+  @func    : DYParser_Init
+  @param   : DYParser_t *parser
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Empty parser without handlers.
+********************************************************************************/
+void DYParser_Init(DYParser_t *parser) {
+    memset(parser, 0, sizeof(*parser));
+}
+/*******************************************************************************
+  @func    : DYParser_Reset
+  @param   : DYParser_t *parser
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Drop a partial frame, handlers and counters stay.
+********************************************************************************/
+void DYParser_Reset(DYParser_t *parser) {
+    parser->len      = 0;
+    parser->complete = false;
+    parser->replay   = 0;
+}
+/*******************************************************************************
+  @func    : DYParser_SetHandler
+  @param   : DYParser_t *parser, uint8_t opcode, DYParser_Handler_t handler, void *ctx
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Route frames with `opcode` to `handler`, NULL removes it.
+********************************************************************************/
+void DYParser_SetHandler(DYParser_t *parser, uint8_t opcode, DYParser_Handler_t handler, void *ctx) {
+    if (opcode < DY_PARSER_OPCODES) {
+        parser->handler[opcode]    = handler;
+        parser->handlerCtx[opcode] = ctx;
+    }
+}
+/*******************************************************************************
+  @func    : DYParser_SetFallback
+  @param   : DYParser_t *parser, DYParser_Handler_t handler, void *ctx
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Handler for frames whose opcode has none.
+********************************************************************************/
+void DYParser_SetFallback(DYParser_t *parser, DYParser_Handler_t handler, void *ctx) {
+    parser->fallback    = handler;
+    parser->fallbackCtx = ctx;
+}
+/*******************************************************************************
+  @func    : requeue
+  @param   : DYParser_t *parser, uint8_t used
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : The frame in collection failed. Drop its header and put every byte
+             after it back in front of the replay bytes not `used` yet.
+********************************************************************************/
+static void requeue(DYParser_t *parser, uint8_t used) {
+    uint8_t back = parser->len - 1;
+    uint8_t rest = parser->replay - used;
+
+    parser->crcErrors++;
+    parser->skipped++;
+    memmove(&parser->work[back], &parser->work[used], rest);
+    memcpy(&parser->work[0], &parser->frame[1], back);
+    parser->replay = back + rest;
+    parser->len    = 0;
+}
+/*******************************************************************************
+  @func    : drain
+  @param   : DYParser_t *parser
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Parse the replay bytes up to the first valid frame. Bytes after it
+             stay queued for the next call.
+********************************************************************************/
+static bool drain(DYParser_t *parser) {
+    uint8_t i = 0;
+
+    while (i < parser->replay) {
+        uint8_t result = step(parser, parser->work[i++]);
+        if (result == STEP_FRAME) {
+            parser->replay -= i;
+            memmove(&parser->work[0], &parser->work[i], parser->replay);
+            dispatch(parser);
+            return true;
+        }
+        if (result == STEP_ERROR) {
+            requeue(parser, i);
+            i = 0;
+        }
+    }
+    parser->replay = 0;
+    return false;
+}
+/*******************************************************************************
+  @func    : DYParser_Feed
+  @param   : DYParser_t *parser, uint8_t byte
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Add one received byte. Returns true when it completed a valid
+             frame, which was dispatched and stays in `parser->frame` until
+             the next call.
+
+             On a bad checksum or length every byte after the failed header
+             is parsed again, so a real header hidden in there is found.
+********************************************************************************/
+bool DYParser_Feed(DYParser_t *parser, uint8_t byte) {
+    if (parser->complete) {
+        parser->complete = false;
+        parser->len      = 0;
+    }
+
+    if (parser->replay == 0) {
+        /* Fast path, nothing left over from a resync. */
+        uint8_t result = step(parser, byte);
+        if (result == STEP_MORE) {
+            return false;
+        }
+        if (result == STEP_FRAME) {
+            dispatch(parser);
+            return true;
+        }
+        requeue(parser, 0);
+    } else {
+        parser->work[parser->replay++] = byte;
+    }
+    return drain(parser);
+}
+/*******************************************************************************
+  @func    : DYParser_FeedBlock
+  @param   : DYParser_t *parser, const uint8_t *data, uint16_t len
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Add a block of received bytes, e.g. from the RX DMA callback.
+             Returns the number of frames it completed.
+********************************************************************************/
+uint16_t DYParser_FeedBlock(DYParser_t *parser, const uint8_t *data, uint16_t len) {
+    uint16_t frames = 0;
+
+    for (uint16_t i = 0; i < len; i++) {
+        if (DYParser_Feed(parser, data[i])) {
+            frames++;
+        }
+    }
+    return frames;
+}
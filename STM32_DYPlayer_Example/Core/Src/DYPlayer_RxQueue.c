@@ -0,0 +1,174 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_RxQueue.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Wait-free single producer / single consumer answer frame queue.
+********************************************************************************/
+/************************************DEFINES***********************************/
+
+#define RXQ_MASK            (DY_RXQ_LEN - 1)
+
+/************************************INCLUDES***********************************/
+#include <string.h>
+
+#include "DYPlayer_RxQueue.h"
+
+#if (DY_RXQ_LEN & RXQ_MASK) != 0 || DY_RXQ_LEN > 32768
+#error "DY_RXQ_LEN must be a power of 2, at most 32768"
+#endif
+
+
+/*******************************************************************************
+  @func    : loadAcquire
+  @param   : const volatile uint16_t *index
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Read the index of the other side; slot accesses after it can't
+             move before it.
+********************************************************************************/
+static inline uint16_t loadAcquire(const volatile uint16_t *index) {
+#if defined(__ARM_ARCH)
+    uint16_t value = *index;
+
+    __asm volatile ("dmb" ::: "memory");
+    return value;
+#else
+    return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+#endif
+}
+/*******************************************************************************
+  @func    : storeRelease
+  @param   : volatile uint16_t *index, uint16_t value
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Publish an own index; slot accesses before it can't move after it.
+********************************************************************************/
+static inline void storeRelease(volatile uint16_t *index, uint16_t value) {
+#if defined(__ARM_ARCH)
+    __asm volatile ("dmb" ::: "memory");
+    *index = value;
+#else
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+#endif
+}
+/*******************************************************************************
+  @func    : DYRxQueue_Init
+  @param   : DYRxQueue_t *queue
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Empty the queue. Neither side may run meanwhile.
+********************************************************************************/
+void DYRxQueue_Init(DYRxQueue_t *queue) {
+    queue->head    = 0;
+    queue->tail    = 0;
+    queue->dropped = 0;
+}
+/*******************************************************************************
+  @func    : DYRxQueue_Count
+  @param   : const DYRxQueue_t *queue
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : Frames waiting, a snapshot when called from the other side.
+********************************************************************************/
+uint16_t DYRxQueue_Count(const DYRxQueue_t *queue) {
+    uint16_t tail = loadAcquire(&queue->tail);
+
+    return (uint16_t)(loadAcquire(&queue->head) - tail);
+}
+/*******************************************************************************
+  @func    : DYRxQueue_Reserve
+  @param   : DYRxQueue_t *queue
+  @return  : DYRxFrame_t *
+  @date	   : 16.10.26
+  @brief   : Producer side. The slot to fill in place, NULL when the queue is
+             full (the frame counts as dropped). Not visible before
+             DYRxQueue_Commit(); reserving again returns the same slot.
+********************************************************************************/
+DYRxFrame_t *DYRxQueue_Reserve(DYRxQueue_t *queue) {
+    uint16_t head = queue->head;
+
+    if ((uint16_t)(head - loadAcquire(&queue->tail)) >= DY_RXQ_LEN) {
+        queue->dropped++;
+        return NULL;
+    }
+    return &queue->slot[head & RXQ_MASK];
+}
+/*******************************************************************************
+  @func    : DYRxQueue_Commit
+  @param   : DYRxQueue_t *queue
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Producer side. Hand the reserved slot to the consumer.
+********************************************************************************/
+void DYRxQueue_Commit(DYRxQueue_t *queue) {
+    storeRelease(&queue->head, (uint16_t)(queue->head + 1U));
+}
+/*******************************************************************************
+  @func    : DYRxQueue_Push
+  @param   : DYRxQueue_t *queue, const uint8_t *frame, uint8_t len
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Producer side. Copy a frame in, false if it is too long or the
+             queue is full.
+********************************************************************************/
+bool DYRxQueue_Push(DYRxQueue_t *queue, const uint8_t *frame, uint8_t len) {
+    if (len > DY_RXQ_FRAME_SIZE) {
+        return false;
+    }
+
+    DYRxFrame_t *slot = DYRxQueue_Reserve(queue);
+
+    if (slot == NULL) {
+        return false;
+    }
+    memcpy(&slot->data[0], frame, len);
+    slot->len = len;
+    DYRxQueue_Commit(queue);
+    return true;
+}
+/*******************************************************************************
+  @func    : DYRxQueue_Peek
+  @param   : const DYRxQueue_t *queue
+  @return  : const DYRxFrame_t *
+  @date	   : 16.10.26
+  @brief   : Consumer side. Oldest frame, read in place until
+             DYRxQueue_Release(); NULL when empty.
+********************************************************************************/
+const DYRxFrame_t *DYRxQueue_Peek(const DYRxQueue_t *queue) {
+    uint16_t tail = queue->tail;
+
+    if (loadAcquire(&queue->head) == tail) {
+        return NULL;
+    }
+    return &queue->slot[tail & RXQ_MASK];
+}
+/*******************************************************************************
+  @func    : DYRxQueue_Release
+  @param   : DYRxQueue_t *queue
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Consumer side. Give the peeked slot back to the producer.
+********************************************************************************/
+void DYRxQueue_Release(DYRxQueue_t *queue) {
+    storeRelease(&queue->tail, (uint16_t)(queue->tail + 1U));
+}
+/*******************************************************************************
+  @func    : DYRxQueue_Pop
+  @param   : DYRxQueue_t *queue, DYRxFrame_t *frame
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Consumer side. Copy the oldest frame out, false when empty.
+********************************************************************************/
+bool DYRxQueue_Pop(DYRxQueue_t *queue, DYRxFrame_t *frame) {
+    const DYRxFrame_t *slot = DYRxQueue_Peek(queue);
+
+    if (slot == NULL) {
+        return false;
+    }
+    *frame = *slot;
+    DYRxQueue_Release(queue);
+    return true;
+}
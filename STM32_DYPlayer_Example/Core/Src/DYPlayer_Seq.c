@@ -0,0 +1,210 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_Seq.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Gapless sequence, the next track fired by the BUSY end edge.
+********************************************************************************/
+/************************************DEFINES***********************************/
+
+#define SEQ_PLAY_OPCODE     0x07    /* playSpecified                           */
+
+/************************************INCLUDES***********************************/
+#include "DYPlayer_Seq.h"
+
+
+/*******************************************************************************
+  @func    : DYSeq_Init
+  @param   : DYSeq_t *seq, DYPlayer_t *player
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Empty sequence on an initialised driver instance.
+********************************************************************************/
+void DYSeq_Init(DYSeq_t *seq, DYPlayer_t *player) {
+    seq->player  = player;
+    seq->count   = 0;
+    seq->next    = 0;
+    seq->running = false;
+    seq->started = false;
+    seq->armed   = false;
+    seq->endedAt = 0;
+    seq->fired   = 0;
+    seq->missed  = 0;
+}
+/*******************************************************************************
+  @func    : DYSeq_Add
+  @param   : DYSeq_t *seq, uint16_t track
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Append a track, false when the sequence is full.
+********************************************************************************/
+bool DYSeq_Add(DYSeq_t *seq, uint16_t track) {
+    if (seq->count >= DY_SEQ_MAX) {
+        return false;
+    }
+    seq->track[seq->count++] = track;
+    return true;
+}
+/*******************************************************************************
+  @func    : maskIrq
+  @param   : void
+  @return  : uint32_t
+  @date	   : 16.10.26
+  @brief   : Mask interrupts on Cortex-M, returns PRIMASK before. Nothing on
+             other targets, the BUSY events then come from one context.
+********************************************************************************/
+static inline uint32_t maskIrq(void) {
+#if defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
+    uint32_t primask;
+
+    __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (primask) :: "memory");
+    return primask;
+#else
+    return 0;
+#endif
+}
+/*******************************************************************************
+  @func    : unmaskIrq
+  @param   : uint32_t primask
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Restore PRIMASK from maskIrq().
+********************************************************************************/
+static inline void unmaskIrq(uint32_t primask) {
+#if defined(__ARM_ARCH_PROFILE) && (__ARM_ARCH_PROFILE == 'M')
+    __asm volatile ("msr primask, %0" :: "r" (primask) : "memory");
+#else
+    (void)primask;
+#endif
+}
+/*******************************************************************************
+  @func    : arm
+  @param   : DYSeq_t *seq
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Build the frame of the next track for the coming end edge,
+             nothing after the last track.
+********************************************************************************/
+static void arm(DYSeq_t *seq) {
+    if (seq->next >= seq->count) {
+        return;
+    }
+    DYFrame_Begin(&seq->frame, SEQ_PLAY_OPCODE);
+    DYFrame_PutWord(&seq->frame, seq->track[seq->next]);
+    DYFrame_End(&seq->frame);
+    seq->armed = true;
+}
+/*******************************************************************************
+  @func    : DYSeq_Start
+  @param   : DYSeq_t *seq
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Play the first track with playSpecified(), the second is armed
+             when it started. The module must play OneOff, the sequence
+             decides what follows. False for an empty sequence.
+********************************************************************************/
+bool DYSeq_Start(DYSeq_t *seq) {
+    if (seq->count == 0) {
+        return false;
+    }
+    uint32_t primask = maskIrq();
+
+    seq->armed   = false;
+    seq->started = false;
+    seq->next    = 1;
+    seq->running = true;
+    unmaskIrq(primask);
+    DYPlayer_PlaySpecified(seq->player, seq->track[0]);
+    return true;
+}
+/*******************************************************************************
+  @func    : DYSeq_Stop
+  @param   : DYSeq_t *seq
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : End the sequence, the track playing runs to its end.
+********************************************************************************/
+void DYSeq_Stop(DYSeq_t *seq) {
+    uint32_t primask = maskIrq();
+
+    seq->running = false;
+    seq->armed   = false;
+    unmaskIrq(primask);
+}
+/*******************************************************************************
+  @func    : DYSeq_Running
+  @param   : const DYSeq_t *seq
+  @return  : bool
+  @date	   : 16.10.26
+  @brief   : Started and the last track has not ended yet.
+********************************************************************************/
+bool DYSeq_Running(const DYSeq_t *seq) {
+    return seq->running;
+}
+/*******************************************************************************
+  @func    : step
+  @param   : DYSeq_t *seq, DYBusyEvent_t event, uint32_t time
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : A start edge arms the next track. On the end edge the armed
+             frame goes to the transport, one write without waiting; after
+             the last track the sequence is over.
+********************************************************************************/
+static void step(DYSeq_t *seq, DYBusyEvent_t event, uint32_t time) {
+    DYPlayer_t *player = seq->player;
+
+    if (!seq->running) {
+        return;
+    }
+    if (event == DY_BUSY_STARTED) {
+        seq->started = true;
+        if (!seq->armed) {
+            arm(seq);
+        }
+        return;
+    }
+    if (!seq->started) {
+        /* Audio from before the start */
+        return;
+    }
+    seq->started = false;
+    if (!seq->armed) {
+        /* Last track over */
+        seq->running = false;
+        return;
+    }
+
+    seq->endedAt = time;
+    seq->armed   = false;
+    if (player->transport->write(player->ctx, &seq->frame.data[0], seq->frame.len) == seq->frame.len) {
+        DYShadow_Record(&player->shadow, &seq->frame.data[0]);
+        player->txFrames++;
+        player->txBytes += seq->frame.len;
+        seq->fired++;
+        seq->next++;
+    } else {
+        /* Nothing will start the module again */
+        player->txDropped++;
+        seq->missed++;
+        seq->running = false;
+    }
+}
+/*******************************************************************************
+  @func    : DYSeq_Busy
+  @param   : void *ctx, DYBusyEvent_t event, uint32_t time
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : DYBusy_t callback, `ctx` is the DYSeq_t. Runs from the EXTI of
+             DYBusy_Edge() and from DYBusy_Poll() in thread context, so the
+             step, its transport write and the counters it updates run with
+             interrupts masked: an edge can't split them, and the two never
+             write to the transport at the same time.
+********************************************************************************/
+void DYSeq_Busy(void *ctx, DYBusyEvent_t event, uint32_t time) {
+    uint32_t primask = maskIrq();
+
+    step((DYSeq_t *)ctx, event, time);
+    unmaskIrq(primask);
+}
@@ -0,0 +1,195 @@
+/*********************************START OF FILE********************************/
+/*******************************************************************************
+  * @file    DYPlayer_Stats.c
+  * @author	 Atakan ERTEKiN , atakanertekinn@gmail.com
+  * @version V1.0.0
+  * @date	 16.10.2026
+  * @rev     V1.0.0
+  * @brief	 Cycle counter timing of the `DYPlayer` calls, empty unless built
+  *          with DY_STATS=1.
+********************************************************************************/
+/************************************INCLUDES***********************************/
+#include <string.h>
+
+#include "DYPlayer_Stats.h"
+
+#if DY_STATS
+
+/******************************************************************************/
+
+static DYStats_t dyStats;
+
+static uint8_t   depth;           /* Nesting of timed calls                     */
+static uint32_t  enteredAt;       /* Counter when the outer call began          */
+static uint32_t  ioCycles;        /* Transport cycles of the outer call so far  */
+static uint32_t  ioAt;            /* Counter when the transport call began      */
+
+#define DY_STATS_NAME_VOID(name, params, args)          #name,
+#define DY_STATS_NAME_VALUE(type, name, params, args)   #name,
+
+static const char *const apiName[DY_API_COUNT] = {
+    DY_STATS_API(DY_STATS_NAME_VOID, DY_STATS_NAME_VALUE)
+    "DYPlayer_Snapshot",
+    "DYPlayer_Resync"
+};
+
+/******************************************************************************/
+
+/*******************************************************************************
+  @func    : DYStats_Init
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Start the cycle counter, clear the statistics and measure the
+             cost of an empty timed call.
+********************************************************************************/
+void DYStats_Init(void) {
+    DY_STATS_START();
+    DYStats_Reset();
+
+    DYStats_Enter();
+    DYStats_Exit(DY_API_COUNT);
+}
+/*******************************************************************************
+  @func    : DYStats_Reset
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Clear the statistics, e.g. at the start of a measurement.
+********************************************************************************/
+void DYStats_Reset(void) {
+    uint32_t overhead = dyStats.overhead;
+
+    memset(&dyStats, 0, sizeof(dyStats));
+    dyStats.overhead = overhead;
+    for (uint8_t i = 0; i < DY_API_COUNT; i++) {
+        dyStats.api[i].total.min     = UINT32_MAX;
+        dyStats.api[i].transport.min = UINT32_MAX;
+        dyStats.api[i].driver.min    = UINT32_MAX;
+    }
+}
+/*******************************************************************************
+  @func    : DYStats_Get
+  @param   : void
+  @return  : const DYStats_t *
+  @date	   : 16.10.26
+  @brief   : Statistics so far. A `min` stays UINT32_MAX while `calls` is 0.
+********************************************************************************/
+const DYStats_t *DYStats_Get(void) {
+    return &dyStats;
+}
+/*******************************************************************************
+  @func    : DYStats_Name
+  @param   : DYApi_t api
+  @return  : const char *
+  @date	   : 16.10.26
+  @brief   : Function name of an entry, for printing the table.
+********************************************************************************/
+const char *DYStats_Name(DYApi_t api) {
+    return (api < DY_API_COUNT) ? apiName[api] : "";
+}
+/*******************************************************************************
+  @func    : DYStats_Mean
+  @param   : const DYStatsRange_t *range, uint32_t calls
+  @return  : uint32_t
+  @date	   : 16.10.26
+  @brief   : Mean cycles per call, 0 without calls.
+********************************************************************************/
+uint32_t DYStats_Mean(const DYStatsRange_t *range, uint32_t calls) {
+    return (calls == 0) ? 0 : (uint32_t)(range->sum / calls);
+}
+/*******************************************************************************
+  @func    : update
+  @param   : DYStatsRange_t *range, uint32_t cycles
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : Add one call to a range.
+********************************************************************************/
+static void update(DYStatsRange_t *range, uint32_t cycles) {
+    if (cycles < range->min) range->min = cycles;
+    if (cycles > range->max) range->max = cycles;
+    range->sum += cycles;
+}
+/*******************************************************************************
+  @func    : DYStats_Enter
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : A timed call begins. Only the outermost one starts the clock.
+********************************************************************************/
+void DYStats_Enter(void) {
+    if (depth++ == 0) {
+        ioCycles  = 0;
+        enteredAt = DY_STATS_CYCLES();
+    }
+}
+/*******************************************************************************
+  @func    : DYStats_Exit
+  @param   : DYApi_t api
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : A timed call returns. The outermost one is added to `api`.
+********************************************************************************/
+void DYStats_Exit(DYApi_t api) {
+    uint32_t total = DY_STATS_CYCLES() - enteredAt;
+
+    if (--depth != 0) {
+        return;
+    }
+    if (api >= DY_API_COUNT) {
+        dyStats.overhead = total;
+        return;
+    }
+
+    DYStatsApi_t *entry = &dyStats.api[api];
+    entry->calls++;
+    update(&entry->total, total);
+    update(&entry->transport, ioCycles);
+    update(&entry->driver, total - ioCycles);
+}
+/*******************************************************************************
+  @func    : DYStats_IoBegin
+  @param   : void
+  @return  : void
+  @date	   : 16.10.26
+  @brief   : The driver calls into the transport.
+********************************************************************************/
+void DYStats_IoBegin(void) {
+    ioAt = DY_STATS_CYCLES();
+}
+/*******************************************************************************
+  @func    : DYStats_IoEnd
+  @param   : uint16_t value
+  @return  : uint16_t
+  @date	   : 16.10.26
+  @brief   : The transport call returned `value`, which is passed through.
+             Its cycles count as transport time of the call around it.
+********************************************************************************/
+uint16_t DYStats_IoEnd(uint16_t value) {
+    ioCycles += DY_STATS_CYCLES() - ioAt;
+    return value;
+}
+
+/******************************************************************************/
+
+#define DY_STATS_WRAP_VOID(name, params, args)                                  \
+    void DYStats_##name params {                                                \
+        DYStats_Enter();                                                        \
+        name args;                                                              \
+        DYStats_Exit(DY_API_##name);                                            \
+    }
+#define DY_STATS_WRAP_VALUE(type, name, params, args)                           \
+    type DYStats_##name params {                                                \
+        DYStats_Enter();                                                        \
+        type value = name args;                                                 \
+        DYStats_Exit(DY_API_##name);                                            \
+        return value;                                                           \
+    }
+
+/*
+ * Timing wrapper of every `DYPlayer` call, e.g. DYStats_play(): enter, call
+ * play(), exit.
+ */
+DY_STATS_API(DY_STATS_WRAP_VOID, DY_STATS_WRAP_VALUE)
+
+#endif /* DY_STATS */
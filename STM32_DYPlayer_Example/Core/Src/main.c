@@ -24,6 +24,12 @@
 /* USER CODE BEGIN Includes */
 
 #include "DYPlayer.h"
+#include "DYPlayer_PortSTM32.h"
+#include "DYPlayer_Batch.h"
+#include "DYPlayer_Stats.h"
+#include "DYPlayer_Trace.h"
+#include "DYPlayer_Busy.h"
+#include "DYPlayer_Async.h"
 
 /* USER CODE END Includes */
 
@@ -36,6 +42,7 @@ char __attribute__((section(".ARM.__at_0x20000000"))) path[10] = "\00001.mp3";
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
+#define DY_ROUND_MS         5000    /* Period of the example command round     */
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -45,16 +52,59 @@ char __attribute__((section(".ARM.__at_0x20000000"))) path[10] = "\00001.mp3";
 
 /* Private variables ---------------------------------------------------------*/
 UART_HandleTypeDef huart4;
+DMA_HandleTypeDef hdma_uart4_rx;
+DMA_HandleTypeDef hdma_uart4_tx;
 
 /* USER CODE BEGIN PV */
 
+/* Incremented by the DMA completion callback for every frame on the wire */
+volatile uint32_t dyFramesSent = 0;
+
+/* DYPlayer on UART4, TX and RX through DMA1 Stream4 / Stream2 */
+static DYUartDMA_t   dyTx;
+static DYUartDMARx_t dyRx;
+static DYPortSTM32_t dyPort = { &huart4, NULL, &dyTx, &dyRx };
+static DYPlayer_t    dyPlayer;
+static DYAsync_t     dyAsync;
+#if DY_TRACE
+static DYTrace_t     dyTrace;
+#endif
+
+/* BUSY of the module on PA4, low while playing, stamped in DWT cycles */
+static DYBusy_t      dyBusy;
+volatile uint32_t    dyTracksEnded = 0;
+
+/* Commands the queue refused, full or longer than DY_ASYNC_FRAME_MAX */
+volatile uint32_t    dyRejected = 0;
+
+/* Last answer to getPlayingDevice, Failed until one came in */
+volatile device_t    dyDevice = Failed;
+
+/* Boot setup, one DMA transfer straight from flash */
+static const uint8_t   dyBootBytes[] = {
+    DY_BATCH_SETDEVICE(Sd),
+    DY_BATCH_SETVOLUME(15),
+    DY_BATCH_SETEQ(Normal),
+    DY_BATCH_SETCYCLEMODE(OneOff)
+};
+static const DYBatch_t dyBoot = DY_BATCH(dyBootBytes);
+
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
 void SystemClock_Config(void);
 static void MX_GPIO_Init(void);
+static void MX_DMA_Init(void);
 static void MX_UART4_Init(void);
 /* USER CODE BEGIN PFP */
+static void DYPlayer_TxDone(const uint8_t *data, uint16_t len);
+#if DY_TRACE
+static void DYPlayer_RxRaw(const uint8_t *data, uint16_t len);
+#endif
+static void DYPlayer_BusyEvent(void *ctx, DYBusyEvent_t event, uint32_t time);
+static void DYPlayer_BusyPoll(void);
+static void DYPlayer_Round(void);
+static void DYPlayer_DeviceAnswer(void *ctx, DYAsyncStatus_t status, uint16_t value);
 
 /* USER CODE END PFP */
 
@@ -91,11 +141,41 @@ int main(void)
 
     /* Initialize all configured peripherals */
     MX_GPIO_Init();
+    MX_DMA_Init();
     MX_UART4_Init();
     /* USER CODE BEGIN 2 */
+    /* BUSY edges wait until the monitor is set up */
+    HAL_NVIC_DisableIRQ(DY_BUSY_EXTI_IRQn);
+    DYPlayer_UartDMA_Init(&dyTx, &huart4);
+    DYPlayer_UartDMA_SetTxCallback(&dyTx, DYPlayer_TxDone);
+    DYPlayer_UartDMA_RxStart(&dyRx, &huart4);
+#if DY_STATS
+    /* Call timing, read DYStats_Get() in the debugger or print it */
+    DYStats_Init();
+#endif
+    DYPortSTM32_CyclesStart();
+    DYBusy_Init(&dyBusy, true, (SystemCoreClock / 1000000U) * DY_BUSY_DEBOUNCE_US,
+                HAL_GPIO_ReadPin(DY_BUSY_GPIO_Port, DY_BUSY_Pin) == GPIO_PIN_SET, DYPortSTM32_Cycles());
+    DYBusy_SetCallback(&dyBusy, DYPlayer_BusyEvent, NULL);
+    HAL_NVIC_EnableIRQ(DY_BUSY_EXTI_IRQn);
+#if DY_TRACE
+    /* Wire trace, dumped over SWO after every round */
+    DYTrace_Init(&dyTrace, &DYTransport_DMA, &dyPort, DYPortSTM32_Cycles, SystemCoreClock);
+    DYPlayer_UartDMA_SetRxCallback(&dyRx, DYPlayer_RxRaw);
+    DYPlayer_Init(&dyPlayer, &DYTransport_Trace, &dyTrace);
+#else
+    DYPlayer_Init(&dyPlayer, &DYTransport_DMA, &dyPort);
+#endif
+    /* checkPlayState() reads the pin, no query on the UART */
+    DYPlayer_SetBusy(&dyPlayer, &dyBusy);
+    DYBatch_Send(&dyPlayer, &dyBoot);
+    /* From here on commands are queued, DYPlayer_Process() moves them along */
+    DYAsync_Init(&dyAsync, &dyPlayer);
+    DYAsync_SetRetries(&dyAsync, 1);
+
+    uint32_t roundAt = HAL_GetTick() - DY_ROUND_MS;
 
     /* USER CODE END 2 */
-    DYPlayer.setVolume(15);
     /* Infinite loop */
     /* USER CODE BEGIN WHILE */
     while (1)
@@ -103,12 +183,16 @@ int main(void)
         /* USER CODE END WHILE */
 
         /* USER CODE BEGIN 3 */
+        uint32_t now = HAL_GetTick();
+
+        if ((now - roundAt) >= DY_ROUND_MS) {
+            roundAt = now;
+            DYPlayer_Round();
+        }
+        DYPlayer_BusyPoll();
+        DYPlayer_Process(&dyPlayer, now * 1000U);
 
-        DYPlayer.playSpecifiedDevicePath(Sd, &path[0]);
-        DYPlayer.play();
-        DYPlayer.checkPlayState();
-        DYPlayer.getPlayingDevice();
-        HAL_Delay(5000);
+        /* Nothing above waits, time critical work of the application fits here */
     }
     /* USER CODE END 3 */
 }
@@ -185,6 +269,23 @@ static void MX_UART4_Init(void)
     /* USER CODE END UART4_Init 2 */
 }
 
+/**
+  * Enable DMA controller clock
+  */
+static void MX_DMA_Init(void)
+{
+    /* DMA controller clock enable */
+    __HAL_RCC_DMA1_CLK_ENABLE();
+
+    /* DMA interrupt init */
+    /* DMA1_Stream2_IRQn interrupt configuration */
+    HAL_NVIC_SetPriority(DMA1_Stream2_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Stream2_IRQn);
+    /* DMA1_Stream4_IRQn interrupt configuration */
+    HAL_NVIC_SetPriority(DMA1_Stream4_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(DMA1_Stream4_IRQn);
+}
+
 /**
   * @brief GPIO Initialization Function
   * @param None
@@ -192,13 +293,168 @@ static void MX_UART4_Init(void)
   */
 static void MX_GPIO_Init(void)
 {
+    GPIO_InitTypeDef GPIO_InitStruct = {0};
+
     /* GPIO Ports Clock Enable */
     __HAL_RCC_GPIOH_CLK_ENABLE();
     __HAL_RCC_GPIOA_CLK_ENABLE();
+
+    /*Configure GPIO pin : DY_BUSY_Pin */
+    GPIO_InitStruct.Pin = DY_BUSY_Pin;
+    GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING_FALLING;
+    GPIO_InitStruct.Pull = GPIO_PULLUP;
+    HAL_GPIO_Init(DY_BUSY_GPIO_Port, &GPIO_InitStruct);
+
+    /* EXTI interrupt init*/
+    HAL_NVIC_SetPriority(EXTI4_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(EXTI4_IRQn);
 }
 
 /* USER CODE BEGIN 4 */
 
+/**
+  * @brief  UART transmit complete, chains the next queued DYPlayer frame.
+  * @param  huart: UART handle pointer
+  * @retval None
+  */
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+    DYPlayer_UartDMA_TxCpltHandler(&dyTx, huart);
+}
+
+/**
+  * @brief  UART receive event (IDLE line, half or full DMA buffer).
+  * @param  huart: UART handle pointer
+  * @param  Size: DMA write position in the receive buffer
+  * @retval None
+  */
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
+{
+    DYPlayer_UartDMA_RxEventHandler(&dyRx, huart, Size);
+}
+
+/**
+  * @brief  UART error, restarts the DYPlayer receiver if the HAL stopped it.
+  * @param  huart: UART handle pointer
+  * @retval None
+  */
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+    DYPlayer_UartDMA_RxErrorHandler(&dyRx, huart);
+}
+
+/**
+  * @brief  DYPlayer frame left the UART, called from interrupt context.
+  * @retval None
+  */
+static void DYPlayer_TxDone(const uint8_t *data, uint16_t len)
+{
+    (void)data;
+    (void)len;
+    dyFramesSent++;
+}
+
+#if DY_TRACE
+/**
+  * @brief  Received bytes as they came off the wire, noise included.
+  * @param  data: chunk of the DMA buffer
+  * @param  len: bytes in the chunk
+  * @retval None
+  */
+static void DYPlayer_RxRaw(const uint8_t *data, uint16_t len)
+{
+    DYTrace_RecordRaw(&dyTrace, data, len);
+}
+
+#endif
+/**
+  * @brief  BUSY pin changed, stamps the edge for the DYPlayer monitor.
+  * @param  GPIO_Pin: EXTI line of the pin
+  * @retval None
+  */
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+    if (GPIO_Pin == DY_BUSY_Pin) {
+        DYBusy_Edge(&dyBusy, HAL_GPIO_ReadPin(DY_BUSY_GPIO_Port, DY_BUSY_Pin) == GPIO_PIN_SET,
+                    DYPortSTM32_Cycles());
+    }
+}
+
+/**
+  * @brief  Track started or ended, called from DYPlayer_BusyPoll() or the
+  *         EXTI interrupt once the pin level held for the debounce time.
+  * @param  ctx: unused
+  * @param  event: DY_BUSY_STARTED or DY_BUSY_ENDED
+  * @param  time: DWT cycle stamp of the edge
+  * @retval None
+  */
+static void DYPlayer_BusyEvent(void *ctx, DYBusyEvent_t event, uint32_t time)
+{
+    (void)ctx;
+    (void)time;
+    if (event == DY_BUSY_ENDED) {
+        dyTracksEnded++;
+    }
+}
+
+/**
+  * @brief  Queues one round of the example: path play, play and a device
+  *         query. Play state comes from BUSY, see dyTracksEnded.
+  * @retval None
+  */
+static void DYPlayer_Round(void)
+{
+#if DY_TRACE
+    /* Traffic of the previous round, RX interrupts keep out meanwhile */
+    DYTrace_Enable(&dyTrace, false);
+    DYTrace_Dump(&dyTrace, DYPortSTM32_ItmOut, NULL);
+    DYTrace_Clear(&dyTrace);
+    DYTrace_Enable(&dyTrace, true);
+#endif
+    if (strlen(path) > 0) {
+        DYFrame_t frame;
+
+        DYFrame_Begin(&frame, controlCommands[SPECIFIEDPATH_CMD][CMD_OPCODE_INDEX]);
+        DYFrame_PutByte(&frame, (uint8_t)Sd);
+        DYFrame_PutPath(&frame, &path[0]);
+        if (!DYAsync_SubmitFrame(&dyAsync, &frame, NULL, NULL, NULL)) {
+            dyRejected++;
+        }
+    }
+    if (!DYAsync_Control(&dyAsync, PLAY_CMD, NULL, NULL, NULL)) {
+        dyRejected++;
+    }
+    if (!DYAsync_Control(&dyAsync, QCURRENTPLAY_CMD, DYPlayer_DeviceAnswer, NULL, NULL)) {
+        dyRejected++;
+    }
+}
+
+/**
+  * @brief  Answer to the device query, called from DYPlayer_Process().
+  * @param  ctx: unused
+  * @param  status: DY_ASYNC_DONE or DY_ASYNC_TIMEOUT after the retry
+  * @param  value: device_t of the answer
+  * @retval None
+  */
+static void DYPlayer_DeviceAnswer(void *ctx, DYAsyncStatus_t status, uint16_t value)
+{
+    (void)ctx;
+    dyDevice = (status == DY_ASYNC_DONE) ? (device_t)value : Failed;
+}
+
+/**
+  * @brief  Takes a BUSY level that held for the debounce time, EXTI masked
+  *         meanwhile. A shorter pulse on the pin raises no event.
+  * @retval None
+  */
+static void DYPlayer_BusyPoll(void)
+{
+    HAL_NVIC_DisableIRQ(DY_BUSY_EXTI_IRQn);
+    DYBusy_Poll(&dyBusy, HAL_GPIO_ReadPin(DY_BUSY_GPIO_Port, DY_BUSY_Pin) == GPIO_PIN_SET,
+                DYPortSTM32_Cycles());
+    HAL_NVIC_EnableIRQ(DY_BUSY_EXTI_IRQn);
+}
+
 /* USER CODE END 4 */
 
 /**
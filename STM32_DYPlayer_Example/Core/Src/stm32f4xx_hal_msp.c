@@ -23,6 +23,10 @@
 /* USER CODE BEGIN Includes */
 
 /* USER CODE END Includes */
+extern DMA_HandleTypeDef hdma_uart4_rx;
+
+extern DMA_HandleTypeDef hdma_uart4_tx;
+
 
 /* Private typedef -----------------------------------------------------------*/
 /* USER CODE BEGIN TD */
@@ -105,6 +109,46 @@ void HAL_UART_MspInit(UART_HandleTypeDef *huart)
         GPIO_InitStruct.Alternate = GPIO_AF8_UART4;
         HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
 
+        /* UART4 DMA Init */
+        /* UART4_RX Init */
+        hdma_uart4_rx.Instance = DMA1_Stream2;
+        hdma_uart4_rx.Init.Channel = DMA_CHANNEL_4;
+        hdma_uart4_rx.Init.Direction = DMA_PERIPH_TO_MEMORY;
+        hdma_uart4_rx.Init.PeriphInc = DMA_PINC_DISABLE;
+        hdma_uart4_rx.Init.MemInc = DMA_MINC_ENABLE;
+        hdma_uart4_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+        hdma_uart4_rx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+        hdma_uart4_rx.Init.Mode = DMA_CIRCULAR;
+        hdma_uart4_rx.Init.Priority = DMA_PRIORITY_MEDIUM;
+        hdma_uart4_rx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+        if (HAL_DMA_Init(&hdma_uart4_rx) != HAL_OK)
+        {
+            Error_Handler();
+        }
+
+        __HAL_LINKDMA(huart, hdmarx, hdma_uart4_rx);
+
+        /* UART4_TX Init */
+        hdma_uart4_tx.Instance = DMA1_Stream4;
+        hdma_uart4_tx.Init.Channel = DMA_CHANNEL_4;
+        hdma_uart4_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+        hdma_uart4_tx.Init.PeriphInc = DMA_PINC_DISABLE;
+        hdma_uart4_tx.Init.MemInc = DMA_MINC_ENABLE;
+        hdma_uart4_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+        hdma_uart4_tx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+        hdma_uart4_tx.Init.Mode = DMA_NORMAL;
+        hdma_uart4_tx.Init.Priority = DMA_PRIORITY_LOW;
+        hdma_uart4_tx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+        if (HAL_DMA_Init(&hdma_uart4_tx) != HAL_OK)
+        {
+            Error_Handler();
+        }
+
+        __HAL_LINKDMA(huart, hdmatx, hdma_uart4_tx);
+
+        /* UART4 interrupt Init */
+        HAL_NVIC_SetPriority(UART4_IRQn, 0, 0);
+        HAL_NVIC_EnableIRQ(UART4_IRQn);
         /* USER CODE BEGIN UART4_MspInit 1 */
 
         /* USER CODE END UART4_MspInit 1 */
@@ -133,6 +177,12 @@ void HAL_UART_MspDeInit(UART_HandleTypeDef *huart)
         */
         HAL_GPIO_DeInit(GPIOA, GPIO_PIN_0 | GPIO_PIN_1);
 
+        /* UART4 DMA DeInit */
+        HAL_DMA_DeInit(huart->hdmarx);
+        HAL_DMA_DeInit(huart->hdmatx);
+
+        /* UART4 interrupt DeInit */
+        HAL_NVIC_DisableIRQ(UART4_IRQn);
         /* USER CODE BEGIN UART4_MspDeInit 1 */
 
         /* USER CODE END UART4_MspDeInit 1 */